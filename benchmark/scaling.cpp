@@ -0,0 +1,158 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../examples/schwarz.hpp"
+
+/* One run of the distributed benchmark: the problem of examples/generate.cpp is set up and solved once, and a single
+ * line of JSON is written by the first process, either on the standard output or appended to -benchmark_output. */
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+#ifdef MU_SLEPC
+    SlepcInitialize(&argc, &argv, nullptr, nullptr);
+#elif defined(PETSCSUB)
+    PetscInitialize(&argc, &argv, nullptr, nullptr);
+#endif
+    int rankWorld, sizeWorld;
+    MPI_Comm_size(MPI_COMM_WORLD, &sizeWorld);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rankWorld);
+    HPDDM::Option& opt = *HPDDM::Option::get();
+    opt.parse(argc, argv, rankWorld == 0, {
+        std::forward_as_tuple("overlap=<1>", "Number of grid points in the overlap.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("Nx=<100>", "Number of grid points in the x-direction.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("Ny=<100>", "Number of grid points in the y-direction.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("generate_random_rhs=<0>", "Number of generated random right-hand sides.", HPDDM::Option::Arg::integer),
+        std::forward_as_tuple("symmetric_csr=(0|1)", "Assemble symmetric matrices.", HPDDM::Option::Arg::argument),
+        std::forward_as_tuple("benchmark_output=<output_file>", "Append the results to a file instead of printing them.", HPDDM::Option::Arg::argument)
+    });
+    if(rankWorld != 0)
+        opt.remove("verbosity");
+    std::string options; // command line, escaped so that it may be stored in a JSON string
+    for(int i = 1; i < argc; ++i) {
+        if(i > 1)
+            options += ' ';
+        for(const char* c = argv[i]; *c; ++c) {
+            if(*c == '"' || *c == '\\')
+                options += std::string(1, '\\') + *c;
+            else if(static_cast<unsigned char>(*c) < 0x20) {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(*c)));
+                options += code;
+            }
+            else
+                options += *c;
+        }
+    }
+    std::vector<std::vector<int>> mapping;
+    mapping.reserve(8);
+    std::list<int> o;
+    HPDDM::MatrixCSR<K>* Mat, *MatNeumann = nullptr;
+    K* f, *sol;
+    HPDDM::underlying_type<K>* d = nullptr;
+    int ndof;
+    generate(rankWorld, sizeWorld, o, mapping, ndof, Mat, MatNeumann, d, f, sol);
+    int mu = opt.app()["generate_random_rhs"];
+    HPDDM::Profiler& profiler = *HPDDM::Profiler::get();
+    profiler.reset();
+    profiler.start();
+    double timing[2];
+    int it;
+    HPDDM::underlying_type<K> residual = 0.0;
+    {
+        HPDDM::Schwarz<SUBDOMAIN, COARSEOPERATOR, symCoarse, K> A;
+        MPI_Barrier(MPI_COMM_WORLD);
+        timing[0] = MPI_Wtime();
+        A.Subdomain::initialize(Mat, o, mapping);
+        decltype(mapping)().swap(mapping);
+        A.multiplicityScaling(d);
+        A.initialize(d);
+        if(mu != 0)
+            A.exchange<true>(f, mu);
+        else
+            mu = 1;
+        if(opt.set("schwarz_coarse_correction")) {
+            unsigned short nu = opt["geneo_nu"];
+#ifdef EIGENSOLVER
+            if(nu > 0) {
+                A.solveGEVP<EIGENSOLVER>(MatNeumann);
+                nu = opt["geneo_nu"];
+            }
+            else
+#endif
+            {
+                nu = 1;
+                K** deflation = new K*[1];
+                *deflation = new K[ndof];
+                std::fill_n(*deflation, ndof, 1.0);
+                A.setVectors(deflation);
+            }
+            A.super::initialize(nu);
+            A.buildTwo(MPI_COMM_WORLD);
+        }
+        A.callNumfact();
+        MPI_Barrier(MPI_COMM_WORLD);
+        timing[1] = MPI_Wtime();
+        timing[0] = timing[1] - timing[0];
+        it = HPDDM::IterativeMethod::solve(A, f, sol, mu, A.getCommunicator());
+        MPI_Barrier(MPI_COMM_WORLD);
+        timing[1] = MPI_Wtime() - timing[1];
+        profiler.stop();
+        std::vector<HPDDM::underlying_type<K>> storage(2 * mu);
+        A.computeResidual(sol, f, storage.data(), mu);
+        for(unsigned short nu = 0; nu < mu; ++nu)
+            residual = std::max(residual, storage[1 + 2 * nu] / storage[2 * nu]);
+    }
+    double phases[2 * HPDDM::Profiler::phases];
+    for(unsigned short i = 0; i < HPDDM::Profiler::phases; ++i) {
+        phases[2 * i] = profiler[static_cast<HPDDM::Profiler::Phase>(i)].time_;
+        phases[2 * i + 1] = profiler[static_cast<HPDDM::Profiler::Phase>(i)].calls_;
+    }
+    MPI_Reduce(rankWorld == 0 ? MPI_IN_PLACE : phases, phases, 2 * HPDDM::Profiler::phases, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    MPI_Reduce(rankWorld == 0 ? MPI_IN_PLACE : timing, timing, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    if(rankWorld == 0) {
+        std::ostringstream record;
+        record << std::scientific << std::setprecision(6);
+        record << "{ \"processes\": " << sizeWorld << ", \"Nx\": " << static_cast<int>(opt.app()["Nx"]) << ", \"Ny\": " << static_cast<int>(opt.app()["Ny"]) << ", \"mu\": " << mu;
+        record << ", \"options\": \"" << options << "\", \"iterations\": " << it << ", \"residual\": " << residual;
+        record << ", \"setup\": " << timing[0] << ", \"solve\": " << timing[1] << ", \"phases\": {";
+        for(unsigned short i = 0; i < HPDDM::Profiler::phases; ++i)
+            record << (i ? ", " : " ") << "\"" << HPDDM::Profiler::name(static_cast<HPDDM::Profiler::Phase>(i)) << "\": { \"time\": " << phases[2 * i] << ", \"calls\": " << static_cast<unsigned long long>(phases[2 * i + 1]) << " }";
+        record << " } }\n";
+        std::string filename = opt.prefix("benchmark_output");
+        if(filename.empty())
+            std::cout << record.str();
+        else {
+            std::ofstream output(filename, std::ios_base::app);
+            output << record.str();
+        }
+    }
+    delete [] d;
+    delete MatNeumann;
+    delete [] sol;
+    delete [] f;
+#ifdef MU_SLEPC
+    SlepcFinalize();
+#elif defined(PETSCSUB)
+    PetscFinalize();
+#endif
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,133 @@
+#! /usr/bin/env python
+# -*- coding: utf-8 -*-
+
+"""
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+"""
+
+from __future__ import print_function
+import sys
+import os
+import math
+import json
+import argparse
+import itertools
+import tempfile
+from subprocess import Popen, PIPE
+
+parser = argparse.ArgumentParser(description = "Weak and strong scaling sweeps of the distributed benchmark " +
+                                 "bin/scaling, one JSON record per line.", epilog = "Unknown arguments are forwarded to every run.", add_help = False)
+parser.add_argument("--help", action = "help")
+parser.add_argument("--mpirun", default = "mpirun -np", help = "MPI launcher, followed by the number of processes")
+parser.add_argument("--executable", default = "bin/scaling")
+parser.add_argument("--scaling", choices = [ "weak", "strong", "both" ], default = "both")
+parser.add_argument("--processes", default = "2,4,8", help = "comma-separated list of numbers of processes")
+parser.add_argument("--size", type = int, default = 200, help = "number of grid points per direction, " +
+                    "of the global problem for strong scaling, of a single process for weak scaling")
+parser.add_argument("--krylov_method", default = "gmres", help = "comma-separated list, see -hpddm_krylov_method")
+parser.add_argument("--schwarz_method", default = "ras", help = "comma-separated list, see -hpddm_schwarz_method")
+parser.add_argument("--coarse_correction", default = "none,deflated", help = "comma-separated list, see -hpddm_schwarz_coarse_correction")
+parser.add_argument("--mu", default = "1", help = "comma-separated list of numbers of right-hand sides")
+parser.add_argument("--repeat", type = int, default = 1, help = "number of runs of each configuration, the fastest one is kept")
+parser.add_argument("--output", help = "file in which the records are appended")
+parser.add_argument("--baseline", help = "file of records to compare with")
+parser.add_argument("--tolerance", type = float, default = 0.1, help = "relative slowdown of the setup or solution phases " +
+                    "above which a regression is reported")
+args, forward = parser.parse_known_args()
+
+def configurations():
+    processes = [ int(p) for p in args.processes.split(",") ]
+    scalings = [ "weak", "strong" ] if args.scaling == "both" else [ args.scaling ]
+    for scaling, p, krylov, schwarz, coarse, mu in itertools.product(scalings, processes, args.krylov_method.split(","),
+                                                                     args.schwarz_method.split(","), args.coarse_correction.split(","),
+                                                                     [ int(m) for m in args.mu.split(",") ]):
+        n = args.size if scaling == "strong" else int(round(args.size * math.sqrt(p)))
+        yield dict(scaling = scaling, processes = p, Nx = n, Ny = n, krylov_method = krylov, schwarz_method = schwarz,
+                   coarse_correction = coarse, mu = mu)
+
+def key(record):
+    return tuple(record[k] for k in ("scaling", "processes", "Nx", "Ny", "krylov_method", "schwarz_method", "coarse_correction", "mu"))
+
+def run(configuration):
+    flags = [ "-Nx", str(configuration["Nx"]), "-Ny", str(configuration["Ny"]), "-hpddm_krylov_method", configuration["krylov_method"],
+              "-hpddm_schwarz_method", configuration["schwarz_method"] ]
+    if configuration["coarse_correction"] != "none":
+        flags += [ "-hpddm_schwarz_coarse_correction", configuration["coarse_correction"] ]
+    if configuration["mu"] > 1:
+        flags += [ "-generate_random_rhs", str(configuration["mu"]) ]
+    (fd, filename) = tempfile.mkstemp(suffix = ".json")
+    os.close(fd)
+    best = None
+    for i in range(args.repeat):
+        open(filename, "w").close()
+        command = " ".join(args.mpirun.split() + [ str(configuration["processes"]), args.executable ] + flags + forward +
+                           [ "-benchmark_output", filename ])
+        process = Popen(command, stdout = PIPE, stderr = PIPE, shell = True)
+        (output, err) = process.communicate()
+        if process.wait() != 0:
+            print(" --- run failed: " + command)
+            print(err.decode() if hasattr(err, "decode") else err)
+            break
+        with open(filename, "r") as input:
+            record = json.loads(input.readline())
+        if best is None or record["setup"] + record["solve"] < best["setup"] + best["solve"]:
+            best = record
+    os.remove(filename)
+    if best is not None:
+        best.update(configuration)
+    return best
+
+baseline = {}
+if args.baseline is not None:
+    with open(args.baseline, "r") as input:
+        for line in input:
+            if line.strip():
+                record = json.loads(line)
+                baseline[key(record)] = record
+
+regressions = 0
+output = open(args.output, "a") if args.output is not None else None
+print("%-7s %5s %6s %-8s %-6s %-9s %3s %5s %12s %12s" % ("scaling", "np", "N", "krylov", "schwarz", "coarse", "mu", "it", "setup", "solve"))
+for configuration in configurations():
+    record = run(configuration)
+    if record is None:
+        regressions += 1
+        continue
+    if output is not None:
+        output.write(json.dumps(record, sort_keys = True) + "\n")
+        output.flush()
+    line = "%-7s %5d %6d %-8s %-6s %-9s %3d %5d %12.6e %12.6e" % (record["scaling"], record["processes"], record["Nx"],
+                                                             record["krylov_method"], record["schwarz_method"],
+                                                             record["coarse_correction"], record["mu"], record["iterations"],
+                                                             record["setup"], record["solve"])
+    reference = baseline.get(key(record))
+    if reference is not None:
+        slower = [ phase for phase in ("setup", "solve") if record[phase] > (1.0 + args.tolerance) * reference[phase] ]
+        if record["iterations"] > reference["iterations"]:
+            slower.append("iterations")
+        if slower:
+            regressions += 1
+            line += "  REGRESSION (" + ", ".join(slower) + ")"
+    print(line)
+    sys.stdout.flush()
+if output is not None:
+    output.close()
+sys.exit(1 if regressions else 0)
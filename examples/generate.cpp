@@ -45,6 +45,7 @@ void generate(int rankWorld, int sizeWorld, std::list<int>& o, std::vector<std::
     const int overlap = opt.app()["overlap"];
     const int mu = opt.app()["generate_random_rhs"];
     const bool sym = opt.app().find("symmetric_csr") != opt.app().cend() && (opt.app()["symmetric_csr"] == 1);
+    const HPDDM::underlying_type<K> shift = opt.app()["shift"];
     int xGrid = int(sqrt(sizeWorld));
     while(sizeWorld % xGrid != 0)
         --xGrid;
@@ -234,7 +235,7 @@ void generate(int rankWorld, int sizeWorld, std::list<int>& o, std::vector<std::
                     a[nnz] = -1 / (dx * dx);
                     ja[nnz++] = k - (N == 'C');
                 }
-                a[nnz]  = 2 / (dx * dx) + 2 / (dy * dy);
+                a[nnz]  = 2 / (dx * dx) + 2 / (dy * dy) - shift;
                 ja[nnz++] = k + (N == 'F');
                 ia[++k] = nnz + (N == 'F');
             }
@@ -252,7 +253,7 @@ void generate(int rankWorld, int sizeWorld, std::list<int>& o, std::vector<std::
                     a[nnz] = -1 / (dx * dx);
                     ja[nnz++] = k - (N == 'C');
                 }
-                a[nnz]  = 2 / (dx * dx) + 2 / (dy * dy);
+                a[nnz]  = 2 / (dx * dx) + 2 / (dy * dy) - shift;
                 ja[nnz++] = k + (N == 'F');
                 if(i < iEnd - 1) {
                     a[nnz] = -1 / (dx * dx);
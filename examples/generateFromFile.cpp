@@ -44,8 +44,18 @@ void generate(int rankWorld, int sizeWorld, std::list<int>& o, std::vector<std::
     std::vector<unsigned int> idx;
     Mat = nullptr;
     if(opt.prefix("matrix_filename").size()) {
-        std::ifstream file(opt.prefix("matrix_filename"));
-        Mat = new HPDDM::MatrixCSR<K>(file);
+#if defined(__unix__) || defined(__APPLE__)
+        if(opt.app().find("map_matrix") != opt.app().cend() && opt.app()["map_matrix"] == 1) {
+            static std::unique_ptr<HPDDM::MatrixMap<K>> map;
+            map.reset(new HPDDM::MatrixMap<K>(opt.prefix("matrix_filename")));
+            Mat = new HPDDM::MatrixCSR<K>(map->A_->n_, map->A_->m_, map->A_->nnz_, map->A_->a_, map->A_->ia_, map->A_->ja_, map->A_->sym_);
+        }
+        else
+#endif
+        {
+            std::ifstream file(opt.prefix("matrix_filename"));
+            Mat = new HPDDM::MatrixCSR<K>(file);
+        }
         ndof = Mat->n_;
     }
     int n;
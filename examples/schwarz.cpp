@@ -50,14 +50,18 @@ int main(int argc, char** argv) {
     HPDDM::Option& opt = *HPDDM::Option::get();
     opt.parse(argc, argv, rankWorld == 0, {
         std::forward_as_tuple("overlap=<1>", "Number of grid points in the overlap.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("gevp_solves=<1>", "Number of times the local generalized eigenvalue problems are solved.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("gevp_perturbation=<0>", "Relative perturbation of some diagonal entries of the local matrices for all but the last generalized eigenvalue problems.", HPDDM::Option::Arg::numeric),
 #ifdef HPDDM_FROMFILE
         std::forward_as_tuple("matrix_filename=<input_file>", "Name of the file in which the matrix is stored.", HPDDM::Option::Arg::argument),
         std::forward_as_tuple("rhs_filename=<input_file>", "Name of the file in which the RHS is stored.", HPDDM::Option::Arg::argument),
+        std::forward_as_tuple("map_matrix=(0|1)", "Map a binary matrix file into memory instead of reading it.", HPDDM::Option::Arg::argument),
 #else
         std::forward_as_tuple("Nx=<100>", "Number of grid points in the x-direction.", HPDDM::Option::Arg::positive),
         std::forward_as_tuple("Ny=<100>", "Number of grid points in the y-direction.", HPDDM::Option::Arg::positive),
         std::forward_as_tuple("generate_random_rhs=<0>", "Number of generated random right-hand sides.", HPDDM::Option::Arg::integer),
         std::forward_as_tuple("symmetric_csr=(0|1)", "Assemble symmetric matrices.", HPDDM::Option::Arg::argument),
+        std::forward_as_tuple("shift=<0>", "Shift subtracted from the diagonal of the assembled matrices.", HPDDM::Option::Arg::numeric),
         std::forward_as_tuple("nonuniform=(0|1)", "Use a different number of eigenpairs to compute on each subdomain.", HPDDM::Option::Arg::argument),
         std::forward_as_tuple("prefix=<string>", "Use a prefix.", HPDDM::Option::Arg::argument)
 #endif
@@ -111,6 +115,24 @@ int main(int argc, char** argv) {
                     if(rankWorld == 4)
                         ref = 0;
                 }
+                for(int i = 1; i < opt.app()["gevp_solves"]; ++i) {
+                    K* a = new K[MatNeumann->nnz_];
+                    int* ia = new int[ndof + 1];
+                    int* ja = new int[MatNeumann->nnz_];
+                    std::copy_n(MatNeumann->a_, MatNeumann->nnz_, a);
+                    std::copy_n(MatNeumann->ia_, ndof + 1, ia);
+                    std::copy_n(MatNeumann->ja_, MatNeumann->nnz_, ja);
+                    // related system, a few diagonal entries are scaled
+                    constexpr char N = HPDDM_NUMBERING;
+                    for(int j = 0; j < ndof; j += 10) {
+                        int* const diagonal = std::lower_bound(ja + ia[j] - (N == 'F'), ja + ia[j + 1] - (N == 'F'), j + (N == 'F'));
+                        if(diagonal != ja + ia[j + 1] - (N == 'F') && *diagonal == j + (N == 'F'))
+                            a[std::distance(ja, diagonal)] *= 1.0 + static_cast<HPDDM::underlying_type<K>>(opt.app()["gevp_perturbation"]);
+                    }
+                    HPDDM::MatrixCSR<K>* copy = new HPDDM::MatrixCSR<K>(ndof, ndof, MatNeumann->nnz_, a, ia, ja, MatNeumann->sym_, true);
+                    A.solveGEVP<EIGENSOLVER>(copy);
+                    delete copy;
+                }
                 A.solveGEVP<EIGENSOLVER>(MatNeumann);
                 nu = opt[prefix + "geneo_nu"];
             }
@@ -205,6 +227,7 @@ int main(int argc, char** argv) {
     delete MatNeumann;
     delete [] sol;
     delete [] f;
+    HPDDM::Profiler::get()->dump(MPI_COMM_WORLD);
 #ifdef MU_SLEPC
     SlepcFinalize();
 #elif defined(PETSCSUB)
@@ -0,0 +1,113 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HPDDM.hpp"
+
+#ifdef FORCE_COMPLEX
+typedef std::complex<double> K;
+#else
+typedef double K;
+#endif
+
+// five-point stencil on a grid x grid mesh with nonsymmetric coefficients, or its upper triangular part
+static void stencil(const int grid, const bool sym, std::vector<K>& a, std::vector<int>& ia, std::vector<int>& ja) {
+    const int m = grid * grid;
+    ia.assign(1, 0);
+    a.clear();
+    ja.clear();
+    for(int i = 0; i < m; ++i) {
+        const int neighbors[5] = { i - grid, i - 1, i, i + 1, i + grid };
+        for(int j : neighbors) {
+            if(j < 0 || j >= m || (sym && j < i) || ((j == i - 1 || j == i + 1) && j / grid != i / grid))
+                continue;
+            a.emplace_back(1.0 + ((7 * i + 13 * j) % 11) / 10.0);
+            if(HPDDM::Wrapper<K>::is_complex)
+                a.back() += ((3 * i + 5 * j) % 7) / 10.0 * std::sqrt(K(-1.0));
+            ja.emplace_back(j);
+        }
+        ia.emplace_back(a.size());
+    }
+}
+
+// straightforward sequential reference for y = beta y + alpha op(A) x
+static void reference(const char trans, const int m, const int n, const int k, const K alpha, const bool sym, const std::vector<K>& a, const std::vector<int>& ia, const std::vector<int>& ja, const K* const x, const K beta, K* const y) {
+    const bool gather = (trans == 'N' && !sym);
+    const int ldx = (gather || sym ? k : m);
+    const int ldy = (gather || sym ? m : k);
+    for(int c = 0; c < n; ++c) {
+        std::vector<K> sum(ldy);
+        for(int i = 0; i < m; ++i)
+            for(int l = ia[i]; l < ia[i + 1]; ++l) {
+                const int j = ja[l];
+                const K v = (trans == 'C' ? HPDDM::Wrapper<K>::conj(a[l]) : a[l]);
+                if(gather)
+                    sum[i] += v * x[c * ldx + j];
+                else {
+                    sum[j] += v * x[c * ldx + i];
+                    if(sym && i != j)
+                        sum[i] += v * x[c * ldx + j];
+                }
+            }
+        for(int i = 0; i < ldy; ++i)
+            y[c * ldy + i] = beta * y[c * ldy + i] + alpha * sum[i];
+    }
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+    HPDDM::Option& opt = *HPDDM::Option::get();
+    opt.parse(argc, argv, 1, {
+        std::forward_as_tuple("grid=<200>", "Number of grid points in each direction.", HPDDM::Option::Arg::integer)
+    });
+    const int grid = opt.app()["grid"];
+    const int m = grid * grid;
+    int failed = 0;
+    for(const bool sym : { false, true })
+        for(const char trans : { 'N', 'T', 'C' }) {
+            if(trans == 'C' && !HPDDM::Wrapper<K>::is_complex)
+                continue;
+            std::vector<K> a;
+            std::vector<int> ia, ja;
+            stencil(grid, sym, a, ia, ja);
+            for(const int n : { 1, 3, 8, 19 }) {
+                std::vector<K> x(m * n), y(m * n), z;
+                for(int i = 0; i < m * n; ++i) {
+                    x[i] = std::cos(0.1 * i);
+                    y[i] = std::sin(0.3 * i);
+                }
+                z = y;
+                const K alpha = 0.5, beta = -2.0;
+                HPDDM::Wrapper<K>::csrmm<'C'>(&trans, &m, &n, &m, &alpha, sym, a.data(), ia.data(), ja.data(), x.data(), &beta, y.data());
+                reference(trans, m, n, m, alpha, sym, a, ia, ja, x.data(), beta, z.data());
+                HPDDM::underlying_type<K> error = 0.0, norm = 0.0;
+                for(int i = 0; i < m * n; ++i) {
+                    error = std::max(error, HPDDM::abs(y[i] - z[i]));
+                    norm = std::max(norm, HPDDM::abs(z[i]));
+                }
+                const bool pass = (error <= 1.0e+3 * std::numeric_limits<HPDDM::underlying_type<K>>::epsilon() * norm);
+                std::cout << (n == 1 ? "csrmv" : "csrmm") << (sym ? " (symmetric)" : "") << ", op = " << trans << ", n = " << n << ", error = " << error << (pass ? "" : " [FAILED]") << std::endl;
+                failed += !pass;
+            }
+        }
+    MPI_Finalize();
+    return failed;
+}
@@ -0,0 +1,185 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "schwarz.hpp"
+
+static_assert(HPDDM_NUMBERING == 'C', "Substructuring methods require 0-based indexing");
+
+/* Reaction--diffusion problem on the strip (0, P) x (0, Ny / Nx), with P the number of processes, discretized with
+ * bilinear finite elements. Each process owns a square of Nx x Ny elements, so that the interface of a subdomain is made
+ * of at most two vertical lines of Ny + 1 nodes, without cross points, and the local Neumann matrices are nonsingular.
+ * The problem is solved with FETI or BDD and the solutions are checked. */
+template<class Method>
+static int solve(const int rankWorld, const int sizeWorld) {
+    const HPDDM::Option& opt = *HPDDM::Option::get();
+    const int Nx = opt.app()["Nx"];
+    const int Ny = opt.app()["Ny"];
+    const int n = (Nx + 1) * (Ny + 1);
+    const int mu = std::max(1, static_cast<int>(opt.app()["generate_random_rhs"]));
+    const HPDDM::underlying_type<K> h = 1.0 / Nx;
+    const HPDDM::underlying_type<K> kappa = (rankWorld % 2 ? opt.app()["contrast"] : 1.0);
+    // entries of the elementary stiffness and mass matrices, indexed by the Manhattan distance between two vertices
+    const HPDDM::underlying_type<K> stiffness[3] = { 2.0 / 3.0, -1.0 / 6.0, -1.0 / 3.0 };
+    const HPDDM::underlying_type<K> mass[3] = { h * h / 9, h * h / 18, h * h / 36 };
+    HPDDM::MatrixCSR<K>* Mat = new HPDDM::MatrixCSR<K>(n, n, (3 * Nx + 1) * (3 * Ny + 1), false);
+    Mat->ia_[0] = 0;
+    for(int j = 0, nnz = 0; j <= Ny; ++j) {
+        for(int i = 0; i <= Nx; ++i) {
+            for(int dj = -1; dj <= 1; ++dj) {
+                for(int di = -1; di <= 1; ++di) {
+                    if(i + di >= 0 && i + di <= Nx && j + dj >= 0 && j + dj <= Ny) {
+                        // number of elements shared by both vertices
+                        const int elements = (di ? 1 : (i > 0) + (i < Nx)) * (dj ? 1 : (j > 0) + (j < Ny));
+                        Mat->a_[nnz] = elements * (kappa * stiffness[std::abs(di) + std::abs(dj)] + mass[std::abs(di) + std::abs(dj)]);
+                        Mat->ja_[nnz++] = (j + dj) * (Nx + 1) + i + di;
+                    }
+                }
+            }
+            Mat->ia_[j * (Nx + 1) + i + 1] = nnz;
+        }
+    }
+    std::vector<int> interface;
+    std::list<int> o;
+    if(rankWorld > 0)
+        o.emplace_back(rankWorld - 1);
+    if(rankWorld < sizeWorld - 1)
+        o.emplace_back(rankWorld + 1);
+    std::vector<std::vector<int>> mapping(o.size());
+    // interface vertices must be sorted, so those shared with both neighbors are interleaved
+    for(int j = 0; j <= Ny; ++j) {
+        if(rankWorld > 0) {
+            mapping.front().emplace_back(interface.size());
+            interface.emplace_back(j * (Nx + 1));
+        }
+        if(rankWorld < sizeWorld - 1) {
+            mapping.back().emplace_back(interface.size());
+            interface.emplace_back(j * (Nx + 1) + Nx);
+        }
+    }
+    Method A;
+    static_cast<HPDDM::Subdomain<K>&>(A).initialize(Mat, o, mapping);
+    A.renumber(interface);
+    char scaling = opt.val<char>("substructuring_scaling", 0);
+    A.buildScaling(scaling);
+    A.callNumfact();
+    A.callNumfactPreconditioner();
+    const bool coarse = (opt.app().find("coarse_correction") != opt.app().cend() && opt.app()["coarse_correction"] == 1);
+    if(coarse) {
+        K** deflation = new K*[1];
+        *deflation = new K[n];
+        std::fill_n(*deflation, n, K(1.0));
+        A.setVectors(deflation);
+        static_cast<typename Method::super::super&>(A).initialize(1);
+    }
+    const bool refactorize = (opt.app().find("refactorize") != opt.app().cend() && opt.app()["refactorize"] == 1);
+    const int solves = opt.app()["solves"];
+    std::vector<K> f(mu * n), b, x(mu * n);
+    std::vector<HPDDM::underlying_type<K>> storage(2 * mu);
+    std::uniform_real_distribution<HPDDM::underlying_type<K>> uniform(0.0, 1.0);
+    int status = 0, first = 0, second = 0, it = 0;
+    for(int s = 0; s < solves; ++s) {
+        if(s > 0 && refactorize) {
+            A.callNumfact();
+            A.callNumfactPreconditioner();
+        }
+        if(coarse && (s == 0 || refactorize))
+            A.buildTwo(MPI_COMM_WORLD);
+        // after a refactorization, the same right-hand sides are solved for again
+        const int wave = (refactorize ? 1 : s + 1);
+        std::mt19937 generator(rankWorld + (wave - 1) * sizeWorld);
+        for(int nu = 0; nu < mu; ++nu) {
+            for(int j = 0; j <= Ny; ++j)
+                for(int i = 0; i <= Nx; ++i)
+                    f[nu * n + j * (Nx + 1) + i] = ((i > 0) + (i < Nx)) * ((j > 0) + (j < Ny)) * h * h / 4.0 * (nu == 0 ? std::sin(10.0 * wave * (rankWorld + i * h)) * std::cos(3.0 * j * h) : uniform(generator));
+            A.renumber(interface, f.data() + nu * n);
+        }
+        b = f;
+        std::fill(x.begin(), x.end(), K());
+        it = HPDDM::IterativeMethod::solve(A, f.data(), x.data(), mu, MPI_COMM_WORLD);
+        if(s == 0)
+            first = it;
+        else if(s == 1)
+            second = it;
+        A.computeResidual(x.data(), b.data(), storage.data(), mu, 0);
+        for(int nu = 0; nu < mu; ++nu) {
+            if(rankWorld == 0) {
+                if(nu == 0)
+                    std::cout << " --- residual = ";
+                else
+                    std::cout << "                ";
+                std::cout << std::scientific << storage[2 * nu + 1] << " / " << storage[2 * nu];
+                if(mu > 1)
+                    std::cout << " (rhs #" << nu + 1 << ")";
+                std::cout << std::endl;
+            }
+            if(storage[2 * nu + 1] / storage[2 * nu] > (std::is_same<double, HPDDM::underlying_type<K>>::value ? 1.0e-6 : 1.0e-2))
+                status = 1;
+        }
+    }
+    const int expected = opt.app()["expected_it"];
+    if(expected > 0 && it > expected) {
+        if(rankWorld == 0)
+            std::cout << " --- " << it << " iterations instead of at most " << expected << std::endl;
+        status = 1;
+    }
+    // recycled search directions are discarded after a refactorization, so the last solve starts from scratch
+    if(refactorize && solves > 1 && it != first) {
+        if(rankWorld == 0)
+            std::cout << " --- " << it << " iterations instead of " << first << " after refactorization" << std::endl;
+        status = 1;
+    }
+    // otherwise, the second solve must benefit from the search directions recycled from the first one
+    else if(!refactorize && solves > 1 && opt.val<unsigned short>("substructuring_recycled_directions", 0) && second >= first) {
+        if(rankWorld == 0)
+            std::cout << " --- " << second << " iterations instead of less than " << first << " with recycling" << std::endl;
+        status = 1;
+    }
+    return status;
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+    int rankWorld, sizeWorld;
+    MPI_Comm_size(MPI_COMM_WORLD, &sizeWorld);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rankWorld);
+    HPDDM::Option& opt = *HPDDM::Option::get();
+    opt.parse(argc, argv, rankWorld == 0, {
+        std::forward_as_tuple("Nx=<20>", "Number of elements in the x-direction in each subdomain.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("Ny=<10>", "Number of elements in the y-direction in each subdomain.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("contrast=<1.0>", "Diffusion coefficient in odd-numbered subdomains, it is equal to one in the others.", HPDDM::Option::Arg::numeric),
+        std::forward_as_tuple("generate_random_rhs=<0>", "Number of generated random right-hand sides.", HPDDM::Option::Arg::integer),
+        std::forward_as_tuple("bdd=(0|1)", "Use BDD instead of FETI.", HPDDM::Option::Arg::argument),
+        std::forward_as_tuple("coarse_correction=(0|1)", "Use the constant vectors as a coarse space.", HPDDM::Option::Arg::argument),
+        std::forward_as_tuple("solves=<1>", "Number of successive solves with new right-hand sides.", HPDDM::Option::Arg::positive),
+        std::forward_as_tuple("refactorize=(0|1)", "Refactorize the local matrices between successive solves.", HPDDM::Option::Arg::argument),
+        std::forward_as_tuple("expected_it=<0>", "Maximum number of iterations expected during the last solve, checked if positive.", HPDDM::Option::Arg::integer)
+    });
+    if(rankWorld != 0)
+        opt.remove("verbosity");
+    int status;
+    if(opt.app().find("bdd") != opt.app().cend() && opt.app()["bdd"] == 1)
+        status = solve<HPDDM::Bdd<SUBDOMAIN, COARSEOPERATOR, symCoarse, K>>(rankWorld, sizeWorld);
+    else
+        status = solve<HPDDM::Feti<SUBDOMAIN, COARSEOPERATOR, symCoarse, K, HPDDM::FetiPrcndtnr::DIRICHLET>>(rankWorld, sizeWorld);
+    MPI_Finalize();
+    return status;
+}
@@ -62,6 +62,13 @@
 #   define HPDDM_ICOLLECTIVE  0
 #  endif
 # endif // HPDDM_ICOLLECTIVE
+# if HPDDM_NEIGHBOR_COLLECTIVE
+#  if !(MPI_VERSION >= 3) || defined(PETSC_HAVE_MPIUNI)
+#   pragma message("You cannot use MPI neighborhood collective operations with that MPI implementation")
+#   undef HPDDM_NEIGHBOR_COLLECTIVE
+#   define HPDDM_NEIGHBOR_COLLECTIVE  0
+#  endif
+# endif // HPDDM_NEIGHBOR_COLLECTIVE
 #else
 # ifdef HPDDM_SCHWARZ
 #  undef HPDDM_SCHWARZ
@@ -368,6 +375,7 @@ inline void hash_range(std::size_t& seed, T begin, T end) {
 #  endif
 # endif
 # include "HPDDM_option.hpp"
+# include "HPDDM_profiler.hpp"
 # if defined(INTEL_MKL_VERSION) && INTEL_MKL_VERSION < 110201 && !defined(__INTEL_COMPILER)
 #  ifdef __clang__
 #   pragma clang diagnostic push
@@ -418,6 +426,12 @@ inline void hash_range(std::size_t& seed, T begin, T end) {
 #  ifdef DISSECTIONSUB
 #   include "HPDDM_Dissection.hpp"
 #  endif
+#  ifdef SUPERNODALSUB
+#   include "HPDDM_Supernodal.hpp"
+#  endif
+#  ifdef ILUSUB
+#   include "HPDDM_ILU.hpp"
+#  endif
 #  if defined(DLAPACK) || defined(LAPACKSUB)
 #   include "HPDDM_LAPACK.hpp"
 #  endif
@@ -451,6 +465,10 @@ inline void hash_range(std::size_t& seed, T begin, T end) {
 #      include "HPDDM_ARPACK.hpp"
 #     elif defined(MU_SLEPC)
 #      include "HPDDM_SLEPc.hpp"
+#     elif defined(MU_LOBPCG)
+#      include "HPDDM_LOBPCG.hpp"
+#     elif defined(MU_RANDOMIZED)
+#      include "HPDDM_Randomized.hpp"
 #     endif
 #    endif
 #   endif
@@ -117,11 +117,19 @@ class Arpack : public Eigensolver<K> {
 #else
                 prec->numfact(A, true);
 #endif
+                const int start = (Eigensolver<K>::k_ > 0);
+                if(start) {
+                    std::fill_n(vresid, Eigensolver<K>::n_, K());
+                    for(int i = 0; i < Eigensolver<K>::k_; ++i)
+                        if(Eigensolver<K>::x_[i])
+                            Blas<K>::axpy(&(Eigensolver<K>::n_), &(Wrapper<K>::d__1), Eigensolver<K>::x_[i], &i__1, vresid, &i__1);
+                }
                 do {
                     const int* const n = &(Eigensolver<K>::n_), *const nu = &(Eigensolver<K>::nu_);
                     const underlying_type<K>* const tol = &(Eigensolver<K>::tol_);
                     auto loop = [&]() {
-                        int ido = info = 0;
+                        int ido = 0;
+                        info = start;
                         while(ido != 99) {
                             aupd(&ido, "G", n, which_, nu, tol, vresid, &ncv,
                                  vp, iparam, ipntr, workd, workl, &lworkl, rwork, &info);
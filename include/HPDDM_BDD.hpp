@@ -43,6 +43,48 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
         /* Variable: m
          *  Local partition of unity. */
         underlying_type<K>* m_;
+        /* Function: initialGuess
+         *
+         *  Computes the initial iterate and the first residual of a single right-hand side, see <Bdd::start>. */
+        template<bool excluded>
+        void initialGuess(const K* const f, K* const x, K* const b, K* r) const {
+            if(super::co_) {
+                if(!excluded) {
+                    super::condensateEffort(f, b);
+                    Subdomain<K>::exchange(b ? b : super::structure_ + super::bi_->m_);
+                    if(super::ev_) {
+                        std::copy_n(b ? b : super::structure_ + super::bi_->m_, Subdomain<K>::dof_, x);
+                        Wrapper<K>::diag(Subdomain<K>::dof_, m_, x);
+                        if(super::schur_) {
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), x, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
+                            super::co_->template callSolver<excluded>(super::uc_);
+                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), x, &i__1);
+                        }
+                        else {
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), x, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
+                            super::co_->template callSolver<excluded>(super::uc_);
+                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__0), x, &i__1);
+                        }
+                        Wrapper<K>::diag(Subdomain<K>::dof_, m_, x);
+                    }
+                    else {
+                        std::fill_n(x, Subdomain<K>::dof_, K());
+                        super::co_->template callSolver<excluded>(super::uc_);
+                    }
+                    Subdomain<K>::exchange(x);
+                    super::applyLocalSchurComplement(x, r);
+                    Subdomain<K>::exchange(r);
+                    Blas<K>::axpby(Subdomain<K>::dof_, Wrapper<K>::d__1, b ? b : super::structure_ + super::bi_->m_, 1, Wrapper<K>::d__2, r, 1);
+                }
+                else
+                    super::co_->template callSolver<excluded>(super::uc_);
+            }
+            else if(!excluded) {
+                super::condensateEffort(f, r);
+                Subdomain<K>::exchange(r);
+                std::fill_n(x, Subdomain<K>::dof_, K());
+            }
+        }
     public:
         Bdd() : m_() { }
         ~Bdd() {
@@ -57,14 +99,14 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
             super::template initialize<false>();
             m_ = new underlying_type<K>[Subdomain<K>::dof_];
         }
-        void allocateSingle(K*& primal) const {
-            primal = new K[Subdomain<K>::dof_];
+        void allocateSingle(K*& primal, const unsigned short& mu = 1) const {
+            primal = new K[mu * Subdomain<K>::dof_];
         }
         template<unsigned short N>
-        void allocateArray(K* (&array)[N]) const {
-            *array = new K[N * Subdomain<K>::dof_];
+        void allocateArray(K* (&array)[N], const unsigned short& mu = 1) const {
+            *array = new K[N * mu * Subdomain<K>::dof_];
             for(unsigned short i = 1; i < N; ++i)
-                array[i] = *array + i * Subdomain<K>::dof_;
+                array[i] = *array + i * mu * Subdomain<K>::dof_;
         }
         /* Function: buildScaling
          *
@@ -107,58 +149,36 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    f              - Right-hand side.
          *    x              - Solution vector.
          *    b              - Condensed right-hand side.
-         *    r              - First residual. */
+         *    r              - First residual.
+         *    mu             - Number of right-hand sides. */
         template<bool excluded>
-        bool start(const K* const f, K* const x, K* const b, K* r) const {
-            bool allocate = Subdomain<K>::setBuffer();
-            if(super::co_) {
-                super::start();
-                if(!excluded) {
-                    super::condensateEffort(f, b);
-                    Subdomain<K>::exchange(b ? b : super::structure_ + super::bi_->m_);
-                    if(super::ev_) {
-                        std::copy_n(b ? b : super::structure_ + super::bi_->m_, Subdomain<K>::dof_, x);
-                        Wrapper<K>::diag(Subdomain<K>::dof_, m_, x);
-                        if(super::schur_) {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), x, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
-                            super::co_->template callSolver<excluded>(super::uc_);
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), x, &i__1);
-                        }
-                        else {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), x, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
-                            super::co_->template callSolver<excluded>(super::uc_);
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__0), x, &i__1);
-                        }
-                        Wrapper<K>::diag(Subdomain<K>::dof_, m_, x);
-                    }
-                    else {
-                        std::fill_n(x, Subdomain<K>::dof_, K());
-                        super::co_->template callSolver<excluded>(super::uc_);
-                    }
-                    Subdomain<K>::exchange(x);
-                    super::applyLocalSchurComplement(x, r);
-                    Subdomain<K>::exchange(r);
-                    Blas<K>::axpby(Subdomain<K>::dof_, Wrapper<K>::d__1, b ? b : super::structure_ + super::bi_->m_, 1, Wrapper<K>::d__2, r, 1);
-                }
-                else
-                    super::co_->template callSolver<excluded>(super::uc_);
-            }
-            else if(!excluded) {
-                super::condensateEffort(f, r);
-                Subdomain<K>::exchange(r);
-                std::fill_n(x, Subdomain<K>::dof_, K());
-            }
+        bool start(const K* const f, K* const x, K* const b, K* r, const unsigned short& mu = 1) const {
+            bool allocate = Subdomain<K>::setBuffer(nullptr, 0, mu);
+            if(super::co_)
+                super::start(mu);
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                initialGuess<excluded>(f + nu * Subdomain<K>::a_->n_, x + nu * Subdomain<K>::a_->n_, b ? b + nu * Subdomain<K>::dof_ : nullptr, r + nu * Subdomain<K>::dof_);
             return allocate;
         }
         /* Function: apply
          *
-         *  Applies the global Schur complement to a single right-hand side.
+         *  Applies the global Schur complement to one or multiple right-hand sides.
          *
          * Parameters:
-         *    in             - Input vector.
-         *    out            - Output vector (optional). */
-        void apply(K* const in, K* const out = nullptr) const {
-            if(out) {
+         *    in             - Input vector(s).
+         *    out            - Output vector(s) (optional).
+         *    mu             - Number of vectors. */
+        void apply(K* const in, K* const out = nullptr, const unsigned short& mu = 1) const {
+            if(mu > 1) {
+                K* const y = out ? out : new K[mu * Subdomain<K>::dof_];
+                super::applyLocalSchurComplement(in, y, mu);
+                if(!out) {
+                    std::copy_n(y, mu * Subdomain<K>::dof_, in);
+                    delete [] y;
+                }
+                Subdomain<K>::exchange(out ? out : in, mu);
+            }
+            else if(out) {
                 super::applyLocalSchurComplement(in, out);
                 Subdomain<K>::exchange(out);
             }
@@ -169,40 +189,49 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
         }
         /* Function: precond
          *
-         *  Applies the global preconditioner to a single right-hand side.
+         *  Applies the global preconditioner to one or multiple right-hand sides.
          *
          * Parameters:
-         *    in             - Input vector.
-         *    out            - Output vector (optional). */
-        void precond(K* const in, K* const out = nullptr) const {
-            Wrapper<K>::diag(Subdomain<K>::dof_, m_, in, super::work_ + super::bi_->m_);
+         *    in             - Input vector(s).
+         *    out            - Output vector(s) (optional).
+         *    mu             - Number of vectors. */
+        void precond(K* const in, K* const out = nullptr, const unsigned short& mu = 1) const {
+            Profiler::Event event(Profiler::SOLVE);
+            const int n = mu;
+            K* const work = mu == 1 ? super::work_ : new K[mu * Subdomain<K>::a_->n_];
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                Wrapper<K>::diag(Subdomain<K>::dof_, m_, in + nu * Subdomain<K>::dof_, work + nu * Subdomain<K>::a_->n_ + super::bi_->m_);
             if(!HPDDM_QR || !super::schur_) {
-                std::fill_n(super::work_, super::bi_->m_, K());
-                static_cast<Solver<K>*>(super::pinv_)->solve(super::work_);
+                for(unsigned short nu = 0; nu < mu; ++nu)
+                    std::fill_n(work + nu * Subdomain<K>::a_->n_, super::bi_->m_, K());
+                static_cast<Solver<K>*>(super::pinv_)->solve(work, mu);
             }
             else {
                 if(super::deficiency_)
-                    static_cast<QR<K>*>(super::pinv_)->solve(super::work_ + super::bi_->m_);
+                    for(unsigned short nu = 0; nu < mu; ++nu)
+                        static_cast<QR<K>*>(super::pinv_)->solve(work + nu * Subdomain<K>::a_->n_ + super::bi_->m_);
                 else {
                     int info;
-                    Lapack<K>::potrs("L", &(Subdomain<K>::dof_), &i__1, static_cast<const K*>(super::pinv_), &(Subdomain<K>::dof_), super::work_ + super::bi_->m_, &(Subdomain<K>::dof_), &info);
+                    Lapack<K>::potrs("L", &(Subdomain<K>::dof_), &n, static_cast<const K*>(super::pinv_), &(Subdomain<K>::dof_), work + super::bi_->m_, &(Subdomain<K>::a_->n_), &info);
                 }
             }
-            if(out) {
-                Wrapper<K>::diag(Subdomain<K>::dof_, m_, super::work_ + super::bi_->m_, out);
-                Subdomain<K>::exchange(out);
-            }
-            else {
-                Wrapper<K>::diag(Subdomain<K>::dof_, m_, super::work_ + super::bi_->m_, in);
-                Subdomain<K>::exchange(in);
-            }
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                Wrapper<K>::diag(Subdomain<K>::dof_, m_, work + nu * Subdomain<K>::a_->n_ + super::bi_->m_, (out ? out : in) + nu * Subdomain<K>::dof_);
+            Subdomain<K>::exchange(out ? out : in, mu);
+            if(mu > 1)
+                delete [] work;
         }
         /* Function: callNumfact
-         *  Factorizes <Subdomain::a> or <Schur::schur> if available. */
+         *  Factorizes <Subdomain::a> or <Schur::schur> if available, and discards the search directions recycled by <Iterative method::PCG>. */
         void callNumfact() {
             if(HPDDM_QR && super::schur_) {
+                Subdomain<K>::template destroy<false>();
                 delete super::bb_;
                 super::bb_ = nullptr;
+                if(super::deficiency_)
+                    delete static_cast<QR<K>*>(super::pinv_);
+                else
+                    delete [] static_cast<K*>(super::pinv_);
                 if(super::deficiency_) {
                     super::pinv_ = new QR<K>(Subdomain<K>::dof_, super::schur_);
                     QR<K>* qr = static_cast<QR<K>*>(super::pinv_);
@@ -227,50 +256,56 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    trans          - 'T' if the transposed projection should be applied, 'N' otherwise.
          *
          * Parameters:
-         *    in             - Input vector.
-         *    out            - Output vector (optional). */
+         *    in             - Input vector(s).
+         *    out            - Output vector(s) (optional).
+         *    mu             - Number of vectors. */
         template<bool excluded, char trans>
-        void project(K* const in, K* const out = nullptr) const {
+        void project(K* const in, K* const out = nullptr, const unsigned short& mu = 1) const {
             static_assert(trans == 'T' || trans == 'N', "Unsupported value for argument 'trans'");
             if(super::co_) {
                 if(!excluded) {
+                    const int n = mu;
+                    K* const primal = mu == 1 ? super::structure_ + super::bi_->m_ : new K[mu * Subdomain<K>::dof_];
                     if(trans == 'N')
-                        apply(in, super::structure_ + super::bi_->m_);
+                        apply(in, primal, mu);
                     if(super::ev_) {
                         if(trans == 'N')
-                            Wrapper<K>::diag(Subdomain<K>::dof_, m_, super::structure_ + super::bi_->m_);
+                            Wrapper<K>::diag(Subdomain<K>::dof_, m_, primal, mu);
                         else
-                            Wrapper<K>::diag(Subdomain<K>::dof_, m_, in, super::structure_ + super::bi_->m_);
+                            Wrapper<K>::diag(Subdomain<K>::dof_, m_, in, primal, mu);
                         if(super::schur_) {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::structure_ + super::bi_->m_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
-                            super::co_->template callSolver<excluded>(super::uc_);
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), super::structure_ + super::bi_->m_, &i__1);
+                            Blas<K>::gemm(&(Wrapper<K>::transc), "N", super::co_->getAddrLocal(), &n, &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), primal, &(Subdomain<K>::dof_), &(Wrapper<K>::d__0), super::uc_, super::co_->getAddrLocal());
+                            super::co_->template callSolver<excluded>(super::uc_, mu);
+                            Blas<K>::gemm("N", "N", &(Subdomain<K>::dof_), &n, super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, super::co_->getAddrLocal(), &(Wrapper<K>::d__0), primal, &(Subdomain<K>::dof_));
                         }
                         else {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::structure_ + super::bi_->m_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
-                            super::co_->template callSolver<excluded>(super::uc_);
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__0), super::structure_ + super::bi_->m_, &i__1);
+                            Blas<K>::gemm(&(Wrapper<K>::transc), "N", super::co_->getAddrLocal(), &n, &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), primal, &(Subdomain<K>::dof_), &(Wrapper<K>::d__0), super::uc_, super::co_->getAddrLocal());
+                            super::co_->template callSolver<excluded>(super::uc_, mu);
+                            Blas<K>::gemm("N", "N", &(Subdomain<K>::dof_), &n, super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, super::co_->getAddrLocal(), &(Wrapper<K>::d__0), primal, &(Subdomain<K>::dof_));
                         }
                     }
                     else {
-                        super::co_->template callSolver<excluded>(super::uc_);
-                        std::fill_n(super::structure_ + super::bi_->m_, Subdomain<K>::dof_, K());
+                        super::co_->template callSolver<excluded>(super::uc_, mu);
+                        std::fill_n(primal, mu * Subdomain<K>::dof_, K());
                     }
-                    Wrapper<K>::diag(Subdomain<K>::dof_, m_, super::structure_ + super::bi_->m_);
-                    Subdomain<K>::exchange(super::structure_ + super::bi_->m_);
+                    Wrapper<K>::diag(Subdomain<K>::dof_, m_, primal, mu);
+                    Subdomain<K>::exchange(primal, mu);
                     if(trans == 'T')
-                        apply(super::structure_ + super::bi_->m_);
+                        apply(primal, nullptr, mu);
+                    const int size = mu * Subdomain<K>::dof_;
                     if(out)
-                        for(unsigned int i = 0; i < Subdomain<K>::dof_; ++i)
-                            out[i] = in[i] - *(super::structure_ + super::bi_->m_ + i);
+                        for(int i = 0; i < size; ++i)
+                            out[i] = in[i] - primal[i];
                     else
-                        Blas<K>::axpy(&(Subdomain<K>::dof_), &(Wrapper<K>::d__2), super::structure_ + super::bi_->m_, &i__1, in, &i__1);
+                        Blas<K>::axpy(&size, &(Wrapper<K>::d__2), primal, &i__1, in, &i__1);
+                    if(mu > 1)
+                        delete [] primal;
                 }
                 else
-                    super::co_->template callSolver<excluded>(super::uc_);
+                    super::co_->template callSolver<excluded>(super::uc_, mu);
             }
             else if(!excluded && out)
-                std::copy_n(in, Subdomain<K>::dof_, out);
+                std::copy_n(in, mu * Subdomain<K>::dof_, out);
         }
         /* Function: buildTwo
          *
@@ -295,14 +330,24 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
          *
          * Parameters:
-         *    f              - Right-hand side.
-         *    x              - Solution vector. */
+         *    f              - Right-hand side(s).
+         *    x              - Solution vector(s).
+         *    mu             - Number of right-hand sides. */
         template<bool excluded>
-        void computeSolution(const K* const f, K* const x) const {
+        void computeSolution(const K* const f, K* const x, const unsigned short& mu = 1) const {
             if(!excluded && super::bi_->m_) {
-                std::copy_n(f, super::bi_->m_, x);
-                Wrapper<K>::template csrmv<Wrapper<K>::I>(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), &(super::bi_->m_), &(Wrapper<K>::d__2), false, super::bi_->a_, super::bi_->ia_, super::bi_->ja_, x + super::bi_->m_, &(Wrapper<K>::d__1), x);
-                if(!super::schur_)
+                K* const interior = mu == 1 ? x : new K[mu * super::bi_->m_];
+                for(unsigned short nu = 0; nu < mu; ++nu) {
+                    std::copy_n(f + nu * Subdomain<K>::a_->n_, super::bi_->m_, interior + nu * super::bi_->m_);
+                    Wrapper<K>::template csrmv<Wrapper<K>::I>(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), &(super::bi_->m_), &(Wrapper<K>::d__2), false, super::bi_->a_, super::bi_->ia_, super::bi_->ja_, x + nu * Subdomain<K>::a_->n_ + super::bi_->m_, &(Wrapper<K>::d__1), interior + nu * super::bi_->m_);
+                }
+                if(mu > 1) {
+                    super::s_.solve(interior, mu);
+                    for(unsigned short nu = 0; nu < mu; ++nu)
+                        std::copy_n(interior + nu * super::bi_->m_, super::bi_->m_, x + nu * Subdomain<K>::a_->n_);
+                    delete [] interior;
+                }
+                else if(!super::schur_)
                     super::s_.solve(x);
                 else {
                     std::copy_n(x, super::bi_->m_, super::structure_);
@@ -312,7 +357,7 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
             }
         }
         template<bool>
-        void computeSolution(K* const* const, K* const) const { }
+        void computeSolution(K* const* const, K* const, const unsigned short& = 1) const { }
         /* Function: computeDot
          *
          *  Computes the dot product of two vectors.
@@ -321,17 +366,22 @@ class Bdd : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
          *
          * Parameters:
-         *    a              - Left-hand side.
-         *    b              - Right-hand side. */
+         *    val            - Dot product(s).
+         *    a              - Left-hand side(s).
+         *    b              - Right-hand side(s).
+         *    comm           - Global MPI communicator.
+         *    mu             - Number of dot products. */
         template<bool excluded>
-        void computeDot(underlying_type<K>* const val, const K* const a, const K* const b, const MPI_Comm& comm) const {
-            if(!excluded) {
-                Wrapper<K>::diag(Subdomain<K>::dof_, m_, a, super::work_);
-                *val = std::real(Blas<K>::dot(&(Subdomain<K>::dof_), super::work_, &i__1, b, &i__1));
+        void computeDot(underlying_type<K>* const val, const K* const a, const K* const b, const MPI_Comm& comm, const unsigned short& mu = 1) const {
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                if(!excluded) {
+                    Wrapper<K>::diag(Subdomain<K>::dof_, m_, a + nu * Subdomain<K>::dof_, super::work_);
+                    val[nu] = std::real(Blas<K>::dot(&(Subdomain<K>::dof_), super::work_, &i__1, b + nu * Subdomain<K>::dof_, &i__1));
+                }
+                else
+                    val[nu] = 0.0;
             }
-            else
-                *val = 0.0;
-            MPI_Allreduce(MPI_IN_PLACE, val, 1, Wrapper<K>::mpi_underlying_type(), MPI_SUM, comm);
+            MPI_Allreduce(MPI_IN_PLACE, val, mu, Wrapper<K>::mpi_underlying_type(), MPI_SUM, comm);
         }
         /* Function: getScaling
          *  Returns a constant pointer to <Bdd::m>. */
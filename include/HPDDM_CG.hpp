@@ -45,10 +45,11 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
 #endif
     const int n = excluded ? 0 : A.getDof();
     const int dim = n * mu;
-    underlying_type<K>* res;
-    K* trash;
-    allocate(res, trash, n, id[1] == HPDDM_VARIANT_FLEXIBLE ? 1 : 0, HPDDM_MAX_IT(it, A), mu);
-    short* const hasConverged = new short[mu];
+    const int extra = (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 * HPDDM_MAX_IT(it, A) : 0);
+    char* pool = A.template workspace<char>(bytes<underlying_type<K>>((4 + extra) * mu) + bytes<K>(std::max(1, (4 + extra) * n) * mu) + bytes<short>(mu));
+    underlying_type<K>* const res = carve<underlying_type<K>>(pool, (4 + extra) * mu);
+    K* const trash = carve<K>(pool, std::max(1, (4 + extra) * n) * mu);
+    short* const hasConverged = carve<short>(pool, mu);
     std::fill_n(hasConverged, mu, -HPDDM_MAX_IT(it, A));
     underlying_type<K>* const dir = res + mu;
     K* const z = trash + dim;
@@ -62,7 +63,7 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
     Blas<K>::axpy(&dim, &(Wrapper<K>::d__2), z, &i__1, r, &i__1);
     HPDDM_CALL(A.template apply<excluded>(r, p, mu, z));
 #if defined(PETSC_PCHPDDM_MAXLEVELS)
-    underlying_type<K>* norm = new underlying_type<K>[mu];
+    underlying_type<K>* const norm = res + (3 + extra) * mu;
     PetscCall(A.template apply<excluded>(b, z, mu, trash));
     Wrapper<K>::diag(n, d, z, trash, mu);
     for(unsigned short nu = 0; nu < mu; ++nu)
@@ -92,7 +93,6 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
         PetscCall(KSPMonitor(A.ksp_, 0, A.ksp_->rnorm));
     }
     PetscCall((*A.ksp_->converged)(A.ksp_, 0, A.ksp_->rnorm, &A.ksp_->reason, A.ksp_->cnvP));
-    delete [] norm;
     if(A.ksp_->reason)
         std::fill_n(dir, mu, underlying_type<K>());
     else if(A.ksp_->converged == KSPConvergedSkip)
@@ -109,7 +109,7 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
                 Wrapper<K>::diag(n, d, p, trash, mu);
             for(unsigned short nu = 0; nu < mu; ++nu)
                 dir[mu + nu] = HPDDM::real(Blas<K>::dot(&n, z + n * nu, &i__1, trash + n * nu, &i__1));
-            MPI_Allreduce(MPI_IN_PLACE, dir, 2 * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+            allreduce(dir, 2 * mu, comm);
             if(id[1] == HPDDM_VARIANT_FLEXIBLE) {
                 std::copy_n(p, dim, p + (i + 1) * dim);
                 std::copy_n(dir + mu, mu, dir + (HPDDM_MAX_IT(it, A) + i + 2) * mu);
@@ -132,7 +132,7 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
                 dir[nu] = HPDDM::real(Blas<K>::dot(&n, z + n * nu, &i__1, trash + n * nu, &i__1));
             }
             if(id[1] != HPDDM_VARIANT_FLEXIBLE) {
-                MPI_Allreduce(MPI_IN_PLACE, dir, 2 * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+                allreduce(dir, 2 * mu, comm);
                 for(unsigned short nu = 0; nu < mu; ++nu)
                     Blas<K>::axpby(n, 1.0, z + n * nu, 1, dir[mu + nu], p + n * nu, 1);
             }
@@ -140,7 +140,7 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
                 for(unsigned short k = 0; k < i; ++k)
                     for(unsigned short nu = 0; nu < mu; ++nu)
                         dir[2 * mu + k * mu + nu] = -HPDDM::real(Blas<K>::dot(&n, trash + n * nu, &i__1, p + (HPDDM_MAX_IT(it, A) + k + 1) * dim + n * nu, &i__1)) / dir[(HPDDM_MAX_IT(it, A) + k + 2) * mu + nu];
-                MPI_Allreduce(MPI_IN_PLACE, dir, (i + 2) * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+                allreduce(dir, (i + 2) * mu, comm);
                 if(!excluded && n) {
                     std::copy_n(z, dim, p);
                     for(unsigned short nu = 0; nu < mu; ++nu) {
@@ -176,13 +176,121 @@ inline int IterativeMethod::CG(const Operator& A, const K* const b, K* const x,
 #else
     A.ksp_->its = i;
 #endif
-    delete [] res;
-    if(Wrapper<K>::is_complex)
-        delete [] trash;
-    delete [] hasConverged;
     A.end(allocate);
     return HPDDM_RET(std::min(static_cast<unsigned short>(i), HPDDM_MAX_IT(it, A)));
 }
+#if !defined(PETSC_PCHPDDM_MAXLEVELS)
+template<bool excluded, class Operator, class K>
+inline int IterativeMethod::PIPECG(const Operator& A, const K* const b, K* const x, const int& mu, const MPI_Comm& comm) {
+    underlying_type<K> tol;
+    unsigned short it;
+    char id[2];
+    {
+        const std::string prefix = A.prefix();
+        const Option& opt = *Option::get();
+        if((hpddm_method_id<Operator>::value == 1 || hpddm_method_id<Operator>::value == 4) && (!opt.any_of(prefix + "schwarz_method", { HPDDM_SCHWARZ_METHOD_SORAS, HPDDM_SCHWARZ_METHOD_ASM, HPDDM_SCHWARZ_METHOD_NONE }) || opt.any_of(prefix + "schwarz_coarse_correction", { HPDDM_SCHWARZ_COARSE_CORRECTION_DEFLATED })))
+            return GMRES<excluded>(A, b, x, mu, comm);
+        options<2>(A, &tol, nullptr, &it, id);
+        if(id[1] == HPDDM_VARIANT_FLEXIBLE)
+            return CG<excluded>(A, b, x, mu, comm);
+    }
+    const int n = excluded ? 0 : A.getDof();
+    const int dim = n * mu;
+    char* pool = A.template workspace<char>(bytes<K>(std::max(1, 10 * dim)) + bytes<underlying_type<K>>(6 * mu) + bytes<short>(mu));
+    K* const r = carve<K>(pool, std::max(1, 10 * dim));
+    K* const u = r + dim;
+    K* const w = u + dim;
+    K* const m = w + dim;
+    K* const v = m + dim;
+    K* const z = v + dim;
+    K* const q = z + dim;
+    K* const s = q + dim;
+    K* const p = s + dim;
+    K* const trash = p + dim;
+    underlying_type<K>* const dir = carve<underlying_type<K>>(pool, 6 * mu);
+    underlying_type<K>* const res = dir + 3 * mu;
+    underlying_type<K>* const alpha = res + mu;
+    underlying_type<K>* const gamma = alpha + mu;
+    short* const hasConverged = carve<short>(pool, mu);
+    std::fill_n(hasConverged, mu, -it);
+    const underlying_type<K>* const d = reinterpret_cast<const underlying_type<K>*>(A.getScaling());
+    bool allocate = A.template start<excluded>(b, x, mu);
+    if(!excluded)
+        HPDDM_CALL(A.GMV(x, z, mu));
+    std::copy_n(b, dim, r);
+    Blas<K>::axpy(&dim, &(Wrapper<K>::d__2), z, &i__1, r, &i__1);
+    HPDDM_CALL(A.template apply<excluded>(r, u, mu, trash));
+    if(!excluded)
+        HPDDM_CALL(A.GMV(u, w, mu));
+    int i = 0;
+    while(true) {
+        Wrapper<K>::diag(n, d, u, trash, mu);
+        for(unsigned short nu = 0; nu < mu; ++nu) {
+            dir[nu] = HPDDM::real(Blas<K>::dot(&n, r + n * nu, &i__1, trash + n * nu, &i__1));
+            dir[mu + nu] = HPDDM::real(Blas<K>::dot(&n, w + n * nu, &i__1, trash + n * nu, &i__1));
+            dir[2 * mu + nu] = HPDDM::real(Blas<K>::dot(&n, u + n * nu, &i__1, trash + n * nu, &i__1));
+        }
+#if HPDDM_ICOLLECTIVE
+        MPI_Request rq;
+        MPI_Iallreduce(MPI_IN_PLACE, dir, 3 * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm, &rq);
+#else
+        MPI_Allreduce(MPI_IN_PLACE, dir, 3 * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+#endif
+        HPDDM_CALL(A.template apply<excluded>(w, m, mu, trash));
+        if(!excluded)
+            HPDDM_CALL(A.GMV(m, v, mu));
+#if HPDDM_ICOLLECTIVE
+        MPI_Wait(&rq, MPI_STATUS_IGNORE);
+#endif
+        std::for_each(dir + 2 * mu, dir + 3 * mu, [](underlying_type<K>& y) { y = HPDDM::sqrt(y); });
+        if(i == 0) {
+            std::copy_n(dir + 2 * mu, mu, res);
+            if(std::find_if(res, res + mu, [](const underlying_type<K>& y) { return y < std::numeric_limits<underlying_type<K>>::epsilon(); }) != res + mu)
+                break;
+        }
+        else {
+            checkConvergence<9>(id[0], i, i, tol, mu, res, dir + 2 * mu, hasConverged, it);
+            if(std::find(hasConverged, hasConverged + mu, -it) == hasConverged + mu)
+                break;
+        }
+        if(i == it) {
+            ++i;
+            break;
+        }
+        for(unsigned short nu = 0; nu < mu; ++nu) {
+            if(hasConverged[nu] == -it) {
+                const unsigned int shift = n * nu;
+                if(i == 0) {
+                    alpha[nu] = dir[nu] / dir[mu + nu];
+                    std::copy_n(v + shift, n, z + shift);
+                    std::copy_n(m + shift, n, q + shift);
+                    std::copy_n(w + shift, n, s + shift);
+                    std::copy_n(u + shift, n, p + shift);
+                }
+                else {
+                    const underlying_type<K> beta = dir[nu] / gamma[nu];
+                    alpha[nu] = dir[nu] / (dir[mu + nu] - beta * dir[nu] / alpha[nu]);
+                    Blas<K>::axpby(n, 1.0, v + shift, 1, beta, z + shift, 1);
+                    Blas<K>::axpby(n, 1.0, m + shift, 1, beta, q + shift, 1);
+                    Blas<K>::axpby(n, 1.0, w + shift, 1, beta, s + shift, 1);
+                    Blas<K>::axpby(n, 1.0, u + shift, 1, beta, p + shift, 1);
+                }
+                gamma[nu] = dir[nu];
+                K scal = alpha[nu];
+                Blas<K>::axpy(&n, &scal, p + shift, &i__1, x + shift, &i__1);
+                scal = -scal;
+                Blas<K>::axpy(&n, &scal, s + shift, &i__1, r + shift, &i__1);
+                Blas<K>::axpy(&n, &scal, q + shift, &i__1, u + shift, &i__1);
+                Blas<K>::axpy(&n, &scal, z + shift, &i__1, w + shift, &i__1);
+            }
+        }
+        ++i;
+    }
+    convergence<9>(id[0], i, it);
+    A.end(allocate);
+    return std::min(static_cast<unsigned short>(i), it);
+}
+#endif
 template<bool excluded, class Operator, class K>
 inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x, const int& mu, const MPI_Comm& comm) {
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
@@ -206,7 +314,8 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
     const int n = excluded ? 0 : A.getDof();
     const int dim = n * mu;
     const unsigned int size = 4 * (dim + mu * mu);
-    K* const trash = new K[size];
+    char* pool = A.template workspace<char>(bytes<K>(size) + bytes<underlying_type<K>>(mu));
+    K* const trash = carve<K>(pool, size);
     K* const p = trash + dim;
     K* const z = p + dim;
     K* const r = z + dim;
@@ -242,7 +351,6 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
     if(info == 0)
         info = QR<excluded>(id[1], n, mu, p, gamma, mu, d, trash, comm);
     if(info != mu) {
-        delete [] trash;
         A.end(allocate);
 #if defined(PETSC_PCHPDDM_MAXLEVELS)
         A.ksp_->reason = (info != -1 ? KSP_DIVERGED_BREAKDOWN : KSP_CONVERGED_HAPPY_BREAKDOWN);
@@ -252,7 +360,7 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
     diagonal<3>(id[0], gamma, mu);
 #endif
-    underlying_type<K>* const norm = new underlying_type<K>[mu];
+    underlying_type<K>* const norm = carve<underlying_type<K>>(pool, mu);
     if(m[0] <= 1)
         for(unsigned short nu = 0; nu < mu; ++nu)
             norm[nu] = Blas<K>::nrm2(&(info = nu + 1), gamma + mu * nu, &i__1);
@@ -268,8 +376,6 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
     PetscCall(KSPMonitor(A.ksp_, 0, A.ksp_->rnorm));
     PetscCall((*A.ksp_->converged)(A.ksp_, 0, A.ksp_->rnorm, &A.ksp_->reason, A.ksp_->cnvP));
     if(A.ksp_->reason) {
-        delete [] norm;
-        delete [] trash;
         A.end(allocate);
         return 0;
     }
@@ -291,8 +397,6 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
         MPI_Allreduce(MPI_IN_PLACE, rhs, (mu * (mu + 1)) / 2, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
         Lapack<K>::ppsv("U", &mu, &mu, rhs, rho + mu * mu, &mu, &info);
         if(info) {
-            delete [] norm;
-            delete [] trash;
             A.end(allocate);
 #if defined(PETSC_PCHPDDM_MAXLEVELS)
             A.ksp_->reason = KSP_DIVERGED_BREAKDOWN;
@@ -346,8 +450,6 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
             std::copy_n(rhs, mu * mu, rho + mu * mu);
             Lapack<K>::posv("U", &mu, &mu, rho, &mu, rhs, &mu, &info);
             if(info) {
-                delete [] norm;
-                delete [] trash;
                 A.end(allocate);
 #if defined(PETSC_PCHPDDM_MAXLEVELS)
                 A.ksp_->reason = KSP_DIVERGED_BREAKDOWN;
@@ -360,8 +462,6 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
                 Blas<K>::gemm("N", "N", &n, &mu, &mu, &(Wrapper<K>::d__1), trash, &n, rhs, &mu, &(Wrapper<K>::d__1), p, &n);
             }
             if(QR<excluded>(id[1], n, mu, p, gamma, mu, d, trash, comm) != mu) {
-                delete [] norm;
-                delete [] trash;
                 A.end(allocate);
 #if defined(PETSC_PCHPDDM_MAXLEVELS)
                 A.ksp_->reason = KSP_DIVERGED_BREAKDOWN;
@@ -374,8 +474,6 @@ inline int IterativeMethod::BCG(const Operator& A, const K* const b, K* const x,
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
     convergence<3>(id[0], HPDDM_IT(i, A), HPDDM_MAX_IT(m[1], A));
 #endif
-    delete [] norm;
-    delete [] trash;
     A.end(allocate);
     return HPDDM_RET(std::min(HPDDM_IT(i, A), HPDDM_MAX_IT(m[1], A)));
 }
@@ -401,7 +499,8 @@ inline int IterativeMethod::BFBCG(const Operator& A, const K* const b, K* const
 #endif
     const int n = excluded ? 0 : A.getDof();
     const int dim = n * mu;
-    K* const trash = new K[5 * dim + (mu * (3 * mu + 1)) / 2 + mu / m[0]];
+    char* pool = A.template workspace<char>(bytes<K>(5 * dim + (mu * (3 * mu + 1)) / 2 + mu / m[0]) + bytes<int>(mu) + bytes<underlying_type<K>>(mu));
+    K* const trash = carve<K>(pool, 5 * dim + (mu * (3 * mu + 1)) / 2 + mu / m[0]);
     K* const q = trash + dim;
     K* const r = q + dim;
     K* const p = r + dim;
@@ -409,7 +508,7 @@ inline int IterativeMethod::BFBCG(const Operator& A, const K* const b, K* const
     K* const gamma = z + dim;
     const underlying_type<K>* const d = reinterpret_cast<const underlying_type<K>*>(A.getScaling());
     bool allocate = A.template start<excluded>(b, x, mu);
-    int* const piv = new int[mu];
+    int* const piv = carve<int>(pool, mu);
     int deflated = -1;
     int info;
     if(!excluded)
@@ -421,7 +520,7 @@ inline int IterativeMethod::BFBCG(const Operator& A, const K* const b, K* const
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
     diagonal<6>(id[0], gamma, mu, tol[0], piv);
 #endif
-    underlying_type<K>* const norm = new underlying_type<K>[mu];
+    underlying_type<K>* const norm = carve<underlying_type<K>>(pool, mu);
     if(m[0] <= 1)
         for(unsigned short nu = 0; nu < mu; ++nu)
             norm[nu] = Blas<K>::nrm2(&(info = nu + 1), gamma + mu * nu, &i__1);
@@ -450,9 +549,6 @@ inline int IterativeMethod::BFBCG(const Operator& A, const K* const b, K* const
     else
         A.ksp_->reason = KSP_CONVERGED_HAPPY_BREAKDOWN;
     if(A.ksp_->reason) {
-        delete [] norm;
-        delete [] piv;
-        delete [] trash;
         A.end(allocate);
         return 0;
     }
@@ -538,115 +634,224 @@ inline int IterativeMethod::BFBCG(const Operator& A, const K* const b, K* const
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
     convergence<6>(id[0], HPDDM_IT(i, A), HPDDM_MAX_IT(m[1], A));
 #endif
-    delete [] norm;
-    delete [] piv;
-    delete [] trash;
     A.end(allocate);
     return HPDDM_RET(std::min(HPDDM_IT(i, A), HPDDM_MAX_IT(m[1], A)));
 }
 template<bool excluded, class Operator, class K>
-inline int IterativeMethod::PCG(const Operator& A, const K* const f, K* const x, const MPI_Comm& comm) {
+inline int IterativeMethod::PCG(const Operator& A, const K* const f, K* const x, const int& mu, const MPI_Comm& comm) {
     underlying_type<K> tol;
-    unsigned short it;
+    unsigned short m[3];
     char verbosity;
-    options<8>(A, &tol, nullptr, &it, &verbosity);
+    options<8>(A, &tol, nullptr, m, &verbosity);
+    const unsigned short it = m[0];
+    const unsigned short window = (m[1] && m[1] < it ? m[1] : it);
+    const unsigned short slots = window + 1;
     typedef typename std::conditional<std::is_pointer<typename std::remove_reference<decltype(*A.getScaling())>::type>::value, K**, K*>::type ptr_type;
     const int n = std::is_same<ptr_type, K*>::value ? A.getDof() : A.getMult();
+    const int ln = excluded ? 0 : n;
     const int offset = std::is_same<ptr_type, K*>::value ? A.getEliminated() : 0;
+    const int ldx = A.getDof() + A.getEliminated();
+    const underlying_type<K> factor = std::is_same<ptr_type, K*>::value ? 1.0 : 0.5;
+    // F-orthonormal search directions of previous solves, followed by their images by F
+    const K* U = nullptr;
+    unsigned short q = 0;
+    if(A.recycling()) {
+        if(m[2]) {
+            U = A.storage();
+            q = A.k().second;
+        }
+        else
+            const_cast<Operator&>(A).template destroy<false>();
+    }
+    const K* const C = U + q * ln;
     ptr_type storage[std::is_same<ptr_type, K*>::value ? 1 : 2];
     // storage[0] = r
     // storage[1] = lambda
-    A.allocateArray(storage);
-    auto m = A.getScaling();
-    bool allocate = std::is_same<ptr_type, K*>::value ? A.template start<excluded>(f, x + offset, nullptr, storage[0]) : A.template start<excluded>(f, x, storage[1], storage[0]);
-    std::vector<ptr_type> z;
-    z.reserve(it);
-    ptr_type zCurr;
-    A.allocateSingle(zCurr);
-    z.emplace_back(zCurr);
+    A.allocateArray(storage, mu);
+    auto d = A.getScaling();
+    bool allocate = std::is_same<ptr_type, K*>::value ? A.template start<excluded>(f, x + offset, nullptr, storage[0], mu) : A.template start<excluded>(f, x, storage[1], storage[0], mu);
+    K* const l = std::is_same<ptr_type, K*>::value ? x + offset : data(storage[1]);
+    const int ldl = std::is_same<ptr_type, K*>::value ? ldx : n;
+    // ring buffers of the last search directions p_k and of the z_k = F p_k, carved from the workspace of the operator so that they are reused from one solve to the next
+    const std::size_t table = std::is_same<ptr_type, K*>::value ? 0 : bytes<K*>(std::max(A.getMap().size(), std::size_t(1)));
+    char* pool = A.template workspace<char>(2 * bytes<ptr_type>(slots) + 2 * slots * (table + bytes<K>(mu * n)) + bytes<K>(slots * mu) + bytes<K>((window + q + 1) * mu) + bytes<K>(mu) + 2 * bytes<underlying_type<K>>(mu) + bytes<short>(mu));
+    ptr_type* const z = carve<ptr_type>(pool, slots);
+    ptr_type* const p = carve<ptr_type>(pool, slots);
+    for(unsigned short k = 0; k < slots; ++k) {
+        view(A, z[k], pool, mu * n);
+        view(A, p[k], pool, mu * n);
+    }
+    K* const gamma = carve<K>(pool, slots * mu);
+    K* const work = carve<K>(pool, (window + q + 1) * mu);
+    K* const alpha = carve<K>(pool, mu);
+    underlying_type<K>* const resInit = carve<underlying_type<K>>(pool, mu);
+    underlying_type<K>* const resRel = carve<underlying_type<K>>(pool, mu);
+    short* const hasConverged = carve<short>(pool, mu);
+    std::fill_n(hasConverged, mu, -it);
     if(!excluded)
-        A.precond(storage[0], zCurr);                                                              //     z_0 = M r_0
-
-    underlying_type<K> resInit;
-    A.template computeDot<excluded>(&resInit, zCurr, zCurr, comm);
-    resInit = HPDDM::sqrt(resInit);
+        A.precond(storage[0], z[0], mu);                                                           //     z_0 = M r_0
+    A.template computeDot<excluded>(resInit, z[0], z[0], comm, mu);
+    std::for_each(resInit, resInit + mu, [](underlying_type<K>& y) { y = HPDDM::sqrt(y); });
 
-    std::vector<ptr_type> p;
-    p.reserve(it);
-    ptr_type pCurr;
-    A.allocateSingle(pCurr);
-    p.emplace_back(pCurr);
-
-    K* alpha = new K[excluded ? std::max((unsigned short)(2), it) : 2 * it];
-    underlying_type<K> resRel = std::numeric_limits<underlying_type<K>>::max();
     unsigned short i = 1;
-    while(i <= it) {
+    if(q) {
+        for(unsigned short k = 0; k < q; ++k)
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                work[k * mu + nu] = (excluded ? K() : weightedDot(n, d, data(storage[0]) + nu * n, U + k * ln));
+        MPI_Allreduce(MPI_IN_PLACE, work, q * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+        if(!excluded)
+            for(unsigned short k = 0; k < q; ++k)
+                for(unsigned short nu = 0; nu < mu; ++nu) {
+                    Blas<K>::axpy(&n, work + k * mu + nu, U + k * ln, &i__1, l + nu * ldl, &i__1);                 // l_0 = l_0 + sum < r_0, u_k > u_k
+                    work[k * mu + nu] = -work[k * mu + nu];
+                    Blas<K>::axpy(&n, work + k * mu + nu, C + k * ln, &i__1, data(storage[0]) + nu * n, &i__1);  // r_0 = r_0 - sum < r_0, u_k > F u_k
+                }
+        A.template project<excluded, 'T'>(storage[0], nullptr, mu);
+        if(!excluded)
+            A.precond(storage[0], z[0], mu);
+        A.template computeDot<excluded>(resRel, z[0], z[0], comm, mu);
+        std::for_each(resRel, resRel + mu, [](underlying_type<K>& y) { y = HPDDM::sqrt(y); });
+        checkConvergence<7>(verbosity, 0, 0, tol, mu, resInit, resRel, hasConverged, it);
+        if(std::find(hasConverged, hasConverged + mu, -it) == hasConverged + mu)
+            i = 0;
+    }
+    while(i && i <= it) {
+        const unsigned short first = (i - 1 > window ? i - 1 - window : 0);
+        const unsigned short k = i - 1 - first;
+        ptr_type& zCurr = z[(i - 1) % slots];
+        ptr_type& pCurr = p[(i - 1) % slots];
+        A.template project<excluded, 'N'>(zCurr, pCurr, mu);                                       //     p_i = P z_i
         if(!excluded) {
-            A.template project<excluded, 'N'>(zCurr, pCurr);                                       //     p_i = P z_i
-            for(unsigned short k = 0; k < i - 1; ++k)
-                alpha[it + k] = dot(&n, z[k], &i__1, pCurr, &i__1);
-            MPI_Allreduce(MPI_IN_PLACE, alpha + it, i - 1, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm); // alpha_k = < z_k, p_i >
-            for(unsigned short k = 0; k < i - 1; ++k) {
-                alpha[it + k] /= -alpha[k];
-                axpy(&n, alpha + it + k, p[k], &i__1, pCurr, &i__1);                               //     p_i = p_i - sum < z_k, p_i > / < z_k, p_k > p_k
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                for(unsigned short j = 0; j < k; ++j)
+                    work[j * mu + nu] = weightedDot(n, d, data(z[(first + j) % slots]) + nu * n, data(pCurr) + nu * n);
+                for(unsigned short j = 0; j < q; ++j)
+                    work[(k + j) * mu + nu] = weightedDot(n, d, C + j * ln, data(pCurr) + nu * n);
+                if(i > 1)
+                    work[(k + q) * mu + nu] = weightedDot(n, d, data(zCurr) + nu * n, data(zCurr) + nu * n);
             }
-            A.apply(pCurr, zCurr);                                                                 //     z_i = F p_i
+        }
+        else
+            std::fill_n(work, (k + q + (i > 1)) * mu, K());
+        // a single reduction for the reorthogonalization coefficients and for the norms of the previous preconditioned residuals
+        MPI_Allreduce(MPI_IN_PLACE, work, (k + q + (i > 1)) * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm); // beta_k = < z_k, p_i >
+        if(i > 1) {
+            std::transform(work + (k + q) * mu, work + (k + q + 1) * mu, resRel, [](const K& y) { return HPDDM::sqrt(HPDDM::real(y)); });
+            checkConvergence<7>(verbosity, i - 1, i - 1, tol, mu, resInit, resRel, hasConverged, it);
+            if(std::find(hasConverged, hasConverged + mu, -it) == hasConverged + mu) {
+                --i;
+                break;
+            }
+        }
+        if(!excluded) {
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                if(hasConverged[nu] == -it) {
+                    for(unsigned short j = 0; j < k; ++j) {
+                        work[j * mu + nu] /= -gamma[((first + j) % slots) * mu + nu];
+                        Blas<K>::axpy(&n, work + j * mu + nu, data(p[(first + j) % slots]) + nu * n, &i__1, data(pCurr) + nu * n, &i__1); // p_i = p_i - sum < z_k, p_i > / < z_k, p_k > p_k
+                    }
+                    for(unsigned short j = 0; j < q; ++j) {
+                        work[(k + j) * mu + nu] = -work[(k + j) * mu + nu];
+                        Blas<K>::axpy(&n, work + (k + j) * mu + nu, U + j * ln, &i__1, data(pCurr) + nu * n, &i__1);     // p_i = p_i - sum < F u_k, p_i > u_k
+                    }
+                }
+            A.apply(pCurr, zCurr, mu);                                                             //     z_i = F p_i
 
-            A.allocateSingle(zCurr);
-            if(std::is_same<ptr_type, K*>::value) {
-                diag(n, m, pCurr, zCurr);
-                alpha[i - 1] = dot(&n, z.back(), &i__1, zCurr, &i__1);
-                alpha[i]     = dot(&n, storage[0], &i__1, zCurr, &i__1);
+            ptr_type& zNext = z[i % slots];
+            diag(n, d, pCurr, zNext, mu);
+            K* const w = std::is_same<ptr_type, K*>::value ? data(zNext) : data(pCurr);
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                work[nu]      = factor * Blas<K>::dot(&n, data(zCurr) + nu * n, &i__1, w + nu * n, &i__1);
+                work[mu + nu] = factor * Blas<K>::dot(&n, data(storage[0]) + nu * n, &i__1, w + nu * n, &i__1);
             }
-            else {
-                alpha[i - 1] = dot(&n, z.back(), &i__1, pCurr, &i__1);
-                alpha[i]     = dot(&n, storage[0], &i__1, pCurr, &i__1);
+            MPI_Allreduce(MPI_IN_PLACE, work, 2 * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+            std::copy_n(work, mu, gamma + ((i - 1) % slots) * mu);
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                alpha[nu] = hasConverged[nu] == -it ? work[mu + nu] / work[nu] : K();
+                Blas<K>::axpy(&n, alpha + nu, data(pCurr) + nu * n, &i__1, l + nu * ldl, &i__1);                                                                                    // l_i + 1 = l_i + < r_i, p_i > / < z_i, p_i > p_i
+                alpha[nu] = -alpha[nu];
+                Blas<K>::axpy(&n, alpha + nu, data(zCurr) + nu * n, &i__1, data(storage[0]) + nu * n, &i__1);                                                                   // r_i + 1 = r_i - < r_i, p_i > / < z_i, p_i > z_i
             }
-            MPI_Allreduce(MPI_IN_PLACE, alpha + i - 1, 2, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
-            alpha[it] = alpha[i] / alpha[i - 1];
-            if(std::is_same<ptr_type, K*>::value)
-                axpy(&n, alpha + it, pCurr, &i__1, x + offset, &i__1);
-            else
-                axpy(&n, alpha + it, pCurr, &i__1, storage[1], &i__1);                             // l_i + 1 = l_i + < r_i, p_i > / < z_i, p_i > p_i
-            alpha[it] = -alpha[it];
-            axpy(&n, alpha + it, z.back(), &i__1, storage[0], &i__1);                              // r_i + 1 = r_i - < r_i, p_i > / < z_i, p_i > z_i
-            A.template project<excluded, 'T'>(storage[0]);                                         // r_i + 1 = P^T r_i + 1
+            A.template project<excluded, 'T'>(storage[0], nullptr, mu);                            // r_i + 1 = P^T r_i + 1
 
-            z.emplace_back(zCurr);
-            A.precond(storage[0], zCurr);                                                          // z_i + 1 = M r_i
+            A.precond(storage[0], zNext, mu);                                                      // z_i + 1 = M r_i
         }
         else {
-            A.template project<excluded, 'N'>(zCurr, pCurr);
-            std::fill_n(alpha, i - 1, K());
-            MPI_Allreduce(MPI_IN_PLACE, alpha, i - 1, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
-            std::fill_n(alpha, 2, K());
-            MPI_Allreduce(MPI_IN_PLACE, alpha, 2, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
-            A.template project<excluded, 'T'>(storage[0]);
-        }
-        A.template computeDot<excluded>(&resRel, zCurr, zCurr, comm);
-        resRel = HPDDM::sqrt(resRel);
-        if(verbosity > 2)
-            std::cout << "PCG: " << std::setw(3) << i << " " << resRel << " " << resInit << " " << resRel / resInit << " < " << tol << std::endl;
-        if(resRel / resInit <= tol)
-            break;
-        else
-            ++i;
-        if(!excluded) {
-            A.allocateSingle(pCurr);
-            p.emplace_back(pCurr);
-            diag(n, m, z[i - 2]);
+            std::fill_n(work, 2 * mu, K());
+            MPI_Allreduce(MPI_IN_PLACE, work, 2 * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+            A.template project<excluded, 'T'>(storage[0], nullptr, mu);
         }
+        ++i;
+    }
+    if(i > it) {
+        A.template computeDot<excluded>(resRel, z[it % slots], z[it % slots], comm, mu);
+        std::for_each(resRel, resRel + mu, [](underlying_type<K>& y) { y = HPDDM::sqrt(y); });
+        checkConvergence<7>(verbosity, it, it, tol, mu, resInit, resRel, hasConverged, it);
+        if(std::find(hasConverged, hasConverged + mu, -it) == hasConverged + mu)
+            i = it;
     }
     convergence<7>(verbosity, i, it);
+    if(m[2]) {
+        // the directions still in the ring buffers are made F-orthonormal and appended to the ones of previous solves, the oldest are discarded first
+        const unsigned short completed = std::min(i, it);
+        const unsigned short first = (completed > window ? completed - window : 0);
+        std::vector<std::pair<unsigned short, unsigned short>> fresh;
+        for(unsigned short nu = 0; nu < mu; ++nu)
+            for(unsigned short j = first; j < (hasConverged[nu] >= 0 ? hasConverged[nu] : completed); ++j)
+                fresh.emplace_back(nu, j);
+        if(fresh.size() > m[2])
+            fresh.erase(fresh.begin(), fresh.end() - m[2]);
+        int a = fresh.size();
+        if(a) {
+            std::vector<K> G(a * a);
+            if(!excluded)
+                for(int c = 0; c < a; ++c)
+                    for(int r = 0; r <= c; ++r)
+                        G[c * a + r] = weightedDot(n, d, data(p[fresh[r].second % slots]) + fresh[r].first * n, data(z[fresh[c].second % slots]) + fresh[c].first * n);
+            MPI_Allreduce(MPI_IN_PLACE, G.data(), a * a, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+            // Cholesky factorization G = R^H R, search directions of different right-hand sides may be numerically dependent, and since the entries of G are not exact, a direction is dropped when less than 1% of its squared F-norm is independent of the previous ones
+            std::vector<K> R(a * a);
+            std::vector<int> index;
+            index.reserve(a);
+            int b = 0;
+            for(int c = 0; c < a; ++c) {
+                underlying_type<K> pivot = HPDDM::real(G[c * a + c]);
+                for(int r = 0; r < b; ++r) {
+                    K v = G[c * a + index[r]];
+                    for(int t = 0; t < r; ++t)
+                        v -= Wrapper<K>::conj(R[r * a + t]) * R[b * a + t];
+                    R[b * a + r] = v / R[r * a + r];
+                    pivot -= HPDDM::norm(R[b * a + r]);
+                }
+                if(pivot > underlying_type<K>(1.0e-2) * HPDDM::real(G[c * a + c])) {
+                    R[b * a + b] = HPDDM::sqrt(pivot);
+                    index.emplace_back(c);
+                    ++b;
+                }
+            }
+            if(b) {
+                const int kept = std::min(static_cast<int>(q), m[2] - b);
+                std::vector<K> save(U + (q - kept) * ln, U + q * ln);
+                save.insert(save.end(), C + (q - kept) * ln, C + q * ln);
+                K* const V = static_cast<OptionsPrefix<K>&>(const_cast<Operator&>(A)).allocate(ln, 1, kept + b);
+                K* const FV = V + (kept + b) * ln;
+                std::copy_n(save.cbegin(), kept * ln, V);
+                std::copy_n(save.cbegin() + kept * ln, kept * ln, FV);
+                if(ln) {
+                    for(int c = 0; c < b; ++c) {
+                        std::copy_n(data(p[fresh[index[c]].second % slots]) + fresh[index[c]].first * n, n, V + (kept + c) * ln);
+                        std::copy_n(data(z[fresh[index[c]].second % slots]) + fresh[index[c]].first * n, n, FV + (kept + c) * ln);
+                    }
+                    Blas<K>::trsm("R", "U", "N", "N", &ln, &b, &(Wrapper<K>::d__1), R.data(), &a, V + kept * ln, &ln);
+                    Blas<K>::trsm("R", "U", "N", "N", &ln, &b, &(Wrapper<K>::d__1), R.data(), &a, FV + kept * ln, &ln);
+                }
+            }
+        }
+    }
     if(std::is_same<ptr_type, K*>::value)
-        A.template computeSolution<excluded>(f, x);
+        A.template computeSolution<excluded>(f, x, mu);
     else
-        A.template computeSolution<excluded>(storage[1], x);
-    delete [] alpha;
-    for(auto zCurr : z)
-        clean(zCurr);
-    for(auto pCurr : p)
-        clean(pCurr);
+        A.template computeSolution<excluded>(storage[1], x, mu);
     clean(storage[0]);
     A.end(allocate);
     return std::min(i, it);
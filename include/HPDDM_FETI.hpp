@@ -59,36 +59,147 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *
          * Parameters:
          *    primal         - Primal unknowns.
-         *    dual           - Dual unknowns. */
+         *    dual           - Dual unknowns.
+         *    mu             - Number of vectors.
+         *    ld             - Leading dimension of the primal unknowns. */
         template<char trans, bool scale>
-        void A(K* const primal, K* const* const dual) const {
+        void A(K* const primal, K* const* const dual, const unsigned short& mu = 1, const int& ld = 0) const {
             static_assert(trans == 'T' || trans == 'N', "Unsupported value for argument 'trans'");
             if(trans == 'T') {
-                std::fill_n(primal, Subdomain<K>::dof_, K());
-                for(unsigned short i = 0; i < super::signed_; ++i)
-                    for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j)
-                        primal[Subdomain<K>::map_[i].second[j]] -= scale ? m_[i][j] * dual[i][j] : dual[i][j];
-                for(unsigned short i = super::signed_; i < Subdomain<K>::map_.size(); ++i)
-                    for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j)
-                        primal[Subdomain<K>::map_[i].second[j]] += scale ? m_[i][j] * dual[i][j] : dual[i][j];
+                for(unsigned short nu = 0; nu < mu; ++nu) {
+                    K* const u = primal + nu * ld;
+                    std::fill_n(u, Subdomain<K>::dof_, K());
+                    for(unsigned short i = 0; i < super::signed_; ++i)
+                        for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j)
+                            u[Subdomain<K>::map_[i].second[j]] -= scale ? m_[i][j] * dual[i][nu * super::mult_ + j] : dual[i][nu * super::mult_ + j];
+                    for(unsigned short i = super::signed_; i < Subdomain<K>::map_.size(); ++i)
+                        for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j)
+                            u[Subdomain<K>::map_[i].second[j]] += scale ? m_[i][j] * dual[i][nu * super::mult_ + j] : dual[i][nu * super::mult_ + j];
+                }
             }
             else {
-                for(unsigned short i = 0; i < super::signed_; ++i) {
-                    MPI_Irecv(Subdomain<K>::buff_[i], Subdomain<K>::map_[i].second.size(), Wrapper<K>::mpi_type(), Subdomain<K>::map_[i].first, 0, Subdomain<K>::communicator_, Subdomain<K>::rq_ + i);
-                    for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j)
-                        dual[i][j] = -(scale ? m_[i][j] * primal[Subdomain<K>::map_[i].second[j]] : primal[Subdomain<K>::map_[i].second[j]]);
-                    MPI_Isend(dual[i], Subdomain<K>::map_[i].second.size(), Wrapper<K>::mpi_type(), Subdomain<K>::map_[i].first, 0, Subdomain<K>::communicator_, Subdomain<K>::rq_ + Subdomain<K>::map_.size() + i);
-                }
-                for(unsigned short i = super::signed_; i < Subdomain<K>::map_.size(); ++i) {
-                    MPI_Irecv(Subdomain<K>::buff_[i], Subdomain<K>::map_[i].second.size(), Wrapper<K>::mpi_type(), Subdomain<K>::map_[i].first, 0, Subdomain<K>::communicator_, Subdomain<K>::rq_ + i);
-                    for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j)
-                        dual[i][j] = (scale ? m_[i][j] * primal[Subdomain<K>::map_[i].second[j]] : primal[Subdomain<K>::map_[i].second[j]]);
-                    MPI_Isend(dual[i], Subdomain<K>::map_[i].second.size(), Wrapper<K>::mpi_type(), Subdomain<K>::map_[i].first, 0, Subdomain<K>::communicator_, Subdomain<K>::rq_ + Subdomain<K>::map_.size() + i);
+                for(unsigned short i = 0, size = Subdomain<K>::map_.size(); i < size; ++i) {
+                    const int n = Subdomain<K>::map_[i].second.size();
+                    const underlying_type<K> sign = (i < super::signed_ ? -1.0 : 1.0);
+                    MPI_Irecv(Subdomain<K>::buff_[i], mu * n, Wrapper<K>::mpi_type(), Subdomain<K>::map_[i].first, 0, Subdomain<K>::communicator_, Subdomain<K>::rq_ + i);
+                    for(unsigned short nu = 0; nu < mu; ++nu) {
+                        const K* const u = primal + nu * ld;
+                        K* const v = dual[i] + nu * super::mult_;
+                        for(int j = 0; j < n; ++j)
+                            v[j] = sign * (scale ? m_[i][j] * u[Subdomain<K>::map_[i].second[j]] : u[Subdomain<K>::map_[i].second[j]]);
+                        if(mu > 1)
+                            std::copy_n(v, n, Subdomain<K>::buff_[size + i] + nu * n);
+                    }
+                    MPI_Isend(mu > 1 ? Subdomain<K>::buff_[size + i] : dual[i], mu * n, Wrapper<K>::mpi_type(), Subdomain<K>::map_[i].first, 0, Subdomain<K>::communicator_, Subdomain<K>::rq_ + size + i);
                 }
                 MPI_Waitall(2 * Subdomain<K>::map_.size(), Subdomain<K>::rq_, MPI_STATUSES_IGNORE);
-                Blas<K>::axpy(&(super::mult_), &(Wrapper<K>::d__1), Subdomain<K>::buff_[0], &i__1, *dual, &i__1);
+                for(unsigned short i = 0; i < Subdomain<K>::map_.size(); ++i) {
+                    const int n = Subdomain<K>::map_[i].second.size();
+                    for(unsigned short nu = 0; nu < mu; ++nu)
+                        Blas<K>::axpy(&n, &(Wrapper<K>::d__1), Subdomain<K>::buff_[i] + nu * n, &i__1, dual[i] + nu * super::mult_, &i__1);
+                }
             }
         }
+        /* Function: view
+         *
+         *  Sets pointers to the values shared with each neighbor of a single Lagrange multiplier stored in a block.
+         *
+         * Parameters:
+         *    v              - Pointers to the values shared with each neighbor.
+         *    mult           - Block of Lagrange multipliers.
+         *    nu             - Index of the Lagrange multiplier in the block. */
+        void view(std::vector<K*>& v, K* const* const mult, const unsigned short nu) const {
+            v.resize(Subdomain<K>::map_.size());
+            for(unsigned short i = 0; i < Subdomain<K>::map_.size(); ++i)
+                v[i] = mult[i] + nu * super::mult_;
+        }
+        /* Function: initialGuess
+         *
+         *  Computes the initial Lagrange multiplier and the first residual of a single right-hand side, see <Feti::start>. */
+        template<bool excluded>
+        void initialGuess(const K* const f, K* const x, K* const* const l, K* const* const r) const {
+            Solver<K>* p = static_cast<Solver<K>*>(super::pinv_);
+            if(super::co_) {
+                if(!excluded) {
+                    if(super::ev_) {
+                        if(super::schur_) {
+                            super::condensateEffort(f, nullptr);
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::structure_ + super::bi_->m_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1); //     uc_ = R_b g
+                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                               //     uc_ = (G Q G^T) \ R_b g
+                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);                                              // primal_ = R_b (G Q G^T) \ R f
+                        }
+                        else {
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::a_->n_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::a_->n_), f, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);                              //     uc_ = R f
+                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                               //     uc_ = (G Q G^T) \ R f
+                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);                           // primal_ = R_b (G Q G^T) \ R f
+                        }
+                    }
+                    else {
+                        super::co_->template callSolver<excluded>(super::uc_);
+                        std::fill_n(primal_, Subdomain<K>::dof_, K());
+                    }
+                    A<'N', 0>(primal_, l);                                                            //       l = A R_b (G Q G^T) \ R f
+                    precond(l);                                                                       //       l = Q A R_b (G Q G^T) \ R f
+                    A<'T', 0>(primal_, l);                                                            // primal_ = A^T Q A R_b (G Q G^T) \ R f
+                    std::fill_n(super::structure_, super::bi_->m_, K());
+                    p->solve(super::structure_);                                                      // primal_ = S \ A^T Q A R_b (G Q G^T) \ R f
+                }
+                else
+                    super::co_->template callSolver<excluded>(super::uc_);
+            }
+            if(!excluded) {
+                p->solve(f, x);                                                                       //       x = S \ f
+                if(!super::co_) {
+                    A<'N', 0>(x + super::bi_->m_, r);                                                 //       r = A S \ f
+                    std::fill_n(*l, super::mult_, K());                                               //       l = 0
+                }
+                else {
+                    Blas<K>::axpby(Subdomain<K>::dof_, 1.0, x + super::bi_->m_, 1, -1.0, primal_, 1); // primal_ = S \ (f - A^T Q A R_b (G Q G^T) \ R f)
+                    A<'N', 0>(primal_, r);                                                            //       r = A S \ (f - A^T Q A R_b (G Q G^T) \ R f)
+                    project<excluded, 'T'>(r);                                                        //       r = P^T r
+                }
+            }
+            else if(super::co_)
+                project<excluded, 'T'>(r);
+        }
+        /* Function: recoverSolution
+         *
+         *  Computes the primal solution of a single right-hand side, see <Feti::computeSolution>. */
+        template<bool excluded>
+        void recoverSolution(K* const* const l, K* const x) const {
+            if(!excluded) {
+                A<'T', 0>(primal_, l);                                                                                                                                                                                                                   //    primal_ = A^T l
+                std::fill_n(super::structure_, super::bi_->m_, K());
+                static_cast<Solver<K>*>(super::pinv_)->solve(super::structure_);                                                                                                                                                                         // structure_ = S \ A^T l
+                Blas<K>::axpy(&(Subdomain<K>::a_->n_), &(Wrapper<K>::d__2), super::structure_, &i__1, x, &i__1);                                                                                                                                         //          x = x - S \ A^T l
+                if(super::co_) {
+                    A<'N', 0>(x + super::bi_->m_, dual_);                                                                                                                                                                                                //      dual_ = A (x - S \ A^T l)
+                    precond(dual_);                                                                                                                                                                                                                      //      dual_ = Q A (x - S \ A^T l)
+                    if(!super::ev_)
+                        super::co_->template callSolver<excluded>(super::uc_);
+                    else {
+                        A<'T', 0>(primal_, dual_);                                                                                                                                                                                                       //    primal_ = A^T Q A (x - S \ A^T l)
+                        if(super::schur_) {
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), primal_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);                    //        uc_ = R_b^T A^T Q A (x - S \ A^T l)
+                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                       //        uc_ = (G Q G^T) \ R_b^T A^T Q A (x - S \ A^T l)
+                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);                                      //        x_b = x_b - R_b^T (G Q G^T) \ R_b^T A^T Q A (x - S \ A^T l)
+                            Wrapper<K>::template csrmv<Wrapper<K>::I>(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), &(super::bi_->m_), &(Wrapper<K>::d__2), false, super::bi_->a_, super::bi_->ia_, super::bi_->ja_, primal_, &(Wrapper<K>::d__0), super::work_);
+                            if(super::bi_->m_)
+                                super::s_.solve(super::work_);
+                            Blas<K>::axpy(&(super::bi_->m_), &(Wrapper<K>::d__2), super::work_, &i__1, x, &i__1);
+                            Blas<K>::axpy(&(Subdomain<K>::dof_), &(Wrapper<K>::d__2), primal_, &i__1, x + super::bi_->m_, &i__1);
+                        }
+                        else {
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), primal_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1); //       uc_ = R A^T Q A (x - S \ A^T l)
+                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                       //       uc_ = (G Q G^T) \ R A^T Q A (x - S \ A^T l)
+                            Blas<K>::gemv("N", &(Subdomain<K>::a_->n_), super::co_->getAddrLocal(), &(Wrapper<K>::d__2), *super::ev_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__1), x, &i__1);                                        //         x = x - R^T (G Q G^T) \ R A^T Q A (x - S \ A^T l)
+                        }
+                    }
+                }
+            }
+            else if(super::co_)
+                super::co_->template callSolver<excluded>(super::uc_);
+        }
         template<class U, typename std::enable_if<!Wrapper<U>::is_complex>::type* = nullptr>
         void allocate(U**& dual, underlying_type<U>**& m) {
             static_assert(std::is_same<U, K>::value, "Wrong types");
@@ -139,65 +250,31 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    f              - Right-hand side.
          *    x              - Solution vector.
          *    b              - Condensed right-hand side.
-         *    r              - First residual. */
+         *    r              - First residual.
+         *    mu             - Number of right-hand sides. */
         template<bool excluded>
-        bool start(const K* const f, K* const x, K* const* const l, K* const* const r) const {
-            bool allocate = Subdomain<K>::setBuffer();
-            Solver<K>* p = static_cast<Solver<K>*>(super::pinv_);
-            if(super::co_) {
-                super::start();
-                if(!excluded) {
-                    if(super::ev_) {
-                        if(super::schur_) {
-                            super::condensateEffort(f, nullptr);
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::structure_ + super::bi_->m_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1); //     uc_ = R_b g
-                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                               //     uc_ = (G Q G^T) \ R_b g
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);                                              // primal_ = R_b (G Q G^T) \ R f
-                        }
-                        else {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::a_->n_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::a_->n_), f, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);                              //     uc_ = R f
-                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                               //     uc_ = (G Q G^T) \ R f
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);                           // primal_ = R_b (G Q G^T) \ R f
-                        }
-                    }
-                    else {
-                        super::co_->template callSolver<excluded>(super::uc_);
-                        std::fill_n(primal_, Subdomain<K>::dof_, K());
-                    }
-                    A<'N', 0>(primal_, l);                                                            //       l = A R_b (G Q G^T) \ R f
-                    precond(l);                                                                       //       l = Q A R_b (G Q G^T) \ R f
-                    A<'T', 0>(primal_, l);                                                            // primal_ = A^T Q A R_b (G Q G^T) \ R f
-                    std::fill_n(super::structure_, super::bi_->m_, K());
-                    p->solve(super::structure_);                                                      // primal_ = S \ A^T Q A R_b (G Q G^T) \ R f
-                }
-                else
-                    super::co_->template callSolver<excluded>(super::uc_);
-            }
-            if(!excluded) {
-                p->solve(f, x);                                                                       //       x = S \ f
-                if(!super::co_) {
-                    A<'N', 0>(x + super::bi_->m_, r);                                                 //       r = A S \ f
-                    std::fill_n(*l, super::mult_, K());                                               //       l = 0
-                }
-                else {
-                    Blas<K>::axpby(Subdomain<K>::dof_, 1.0, x + super::bi_->m_, 1, -1.0, primal_, 1); // primal_ = S \ (f - A^T Q A R_b (G Q G^T) \ R f)
-                    A<'N', 0>(primal_, r);                                                            //       r = A S \ (f - A^T Q A R_b (G Q G^T) \ R f)
-                    project<excluded, 'T'>(r);                                                        //       r = P^T r
-                }
+        bool start(const K* const f, K* const x, K* const* const l, K* const* const r, const unsigned short& mu = 1) const {
+            bool allocate = Subdomain<K>::setBuffer(nullptr, 0, mu);
+            if(super::co_)
+                super::start(mu);
+            std::vector<K*> lambda, residual;
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                view(lambda, l, nu);
+                view(residual, r, nu);
+                initialGuess<excluded>(f + nu * Subdomain<K>::a_->n_, x + nu * Subdomain<K>::a_->n_, lambda.data(), residual.data());
             }
-            else if(super::co_)
-                project<excluded, 'T'>(r);
             return allocate;
         }
         /* Function: allocateSingle
          *
-         *  Allocates a single Lagrange multiplier.
+         *  Allocates a single Lagrange multiplier, or a block of Lagrange multipliers.
          *
-         * Parameter:
-         *    mult           - Reference to a Lagrange multiplier. */
-        void allocateSingle(K**& mult) const {
+         * Parameters:
+         *    mult           - Reference to a Lagrange multiplier.
+         *    mu             - Number of Lagrange multipliers. */
+        void allocateSingle(K**& mult, const unsigned short& mu = 1) const {
             mult  = new K*[Subdomain<K>::map_.size()];
-            *mult = new K[super::mult_];
+            *mult = new K[mu * super::mult_];
             for(unsigned short i = 1; i < Subdomain<K>::map_.size(); ++i)
                 mult[i] = mult[i - 1] + Subdomain<K>::map_[i - 1].second.size();
         }
@@ -208,15 +285,16 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          * Template Parameter:
          *    N              - Size of the array.
          *
-         * Parameter:
-         *    array          - Reference to an array of Lagrange multipliers. */
+         * Parameters:
+         *    array          - Reference to an array of Lagrange multipliers.
+         *    mu             - Number of Lagrange multipliers in each block. */
         template<unsigned short N>
-        void allocateArray(K** (&array)[N]) const {
+        void allocateArray(K** (&array)[N], const unsigned short& mu = 1) const {
             *array  = new K*[N * Subdomain<K>::map_.size()];
-            **array = new K[N * super::mult_];
+            **array = new K[N * mu * super::mult_];
             for(unsigned short i = 0; i < N; ++i) {
                 array[i]  = *array + i * Subdomain<K>::map_.size();
-                *array[i] = **array + i * super::mult_;
+                *array[i] = **array + i * mu * super::mult_;
                 for(unsigned short j = 1; j < Subdomain<K>::map_.size(); ++j)
                     array[i][j] = array[i][j - 1] + Subdomain<K>::map_[j - 1].second.size();
             }
@@ -260,13 +338,19 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *  Applies the global FETI operator.
          *
          * Parameters:
-         *    in             - Input vector.
-         *    out            - Output vector (optional). */
-        void apply(K* const* const in, K* const* const out = nullptr) const {
-            A<'T', 0>(primal_, in);
-            std::fill_n(super::structure_, super::bi_->m_, K());
-            static_cast<Solver<K>*>(super::pinv_)->solve(super::structure_);
-            A<'N', 0>(primal_, out ? out : in);
+         *    in             - Input vector(s).
+         *    out            - Output vector(s) (optional).
+         *    mu             - Number of vectors. */
+        void apply(K* const* const in, K* const* const out = nullptr, const unsigned short& mu = 1) const {
+            Profiler::Event event(Profiler::SOLVE);
+            K* const structure = mu == 1 ? super::structure_ : new K[mu * Subdomain<K>::a_->n_];
+            A<'T', 0>(structure + super::bi_->m_, in, mu, Subdomain<K>::a_->n_);
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                std::fill_n(structure + nu * Subdomain<K>::a_->n_, super::bi_->m_, K());
+            static_cast<Solver<K>*>(super::pinv_)->solve(structure, mu);
+            A<'N', 0>(structure + super::bi_->m_, out ? out : in, mu, Subdomain<K>::a_->n_);
+            if(mu > 1)
+                delete [] structure;
         }
         /* Function: applyLocalPreconditioner(n)
          *
@@ -307,16 +391,26 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
         }
         /* Function: precond
          *
-         *  Applies the global preconditioner to a single right-hand side.
+         *  Applies the global preconditioner to one or multiple right-hand sides.
          *
          * Parameters:
-         *    in             - Input vector.
-         *    out            - Output vector (optional). */
+         *    in             - Input vector(s).
+         *    out            - Output vector(s) (optional).
+         *    mu             - Number of vectors. */
         template<FetiPrcndtnr q = P>
-        void precond(K* const* const in, K* const* const out = nullptr) const {
-            A<'T', 1>(primal_, in);
-            applyLocalPreconditioner<q>(primal_);
-            A<'N', 1>(primal_, out ? out : in);
+        void precond(K* const* const in, K* const* const out = nullptr, const unsigned short& mu = 1) const {
+            if(mu == 1) {
+                A<'T', 1>(primal_, in);
+                applyLocalPreconditioner<q>(primal_);
+                A<'N', 1>(primal_, out ? out : in);
+            }
+            else {
+                K* primal = new K[mu * Subdomain<K>::dof_];
+                A<'T', 1>(primal, in, mu, Subdomain<K>::dof_);
+                applyLocalPreconditioner<q>(primal, mu);
+                A<'N', 1>(primal, out ? out : in, mu, Subdomain<K>::dof_);
+                delete [] primal;
+            }
         }
         /* Function: project
          *
@@ -327,49 +421,61 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    trans          - 'T' if the transposed projection should be applied, 'N' otherwise.
          *
          * Parameters:
-         *    in             - Input vector.
-         *    out            - Output vector (optional). */
+         *    in             - Input vector(s).
+         *    out            - Output vector(s) (optional).
+         *    mu             - Number of vectors. */
         template<bool excluded, char trans>
-        void project(K* const* const in, K* const* const out = nullptr) const {
+        void project(K* const* const in, K* const* const out = nullptr, const unsigned short& mu = 1) const {
             static_assert(trans == 'T' || trans == 'N', "Unsupported value for argument 'trans'");
             if(super::co_) {
                 if(!excluded) {
+                    const int n = mu;
+                    K* const primal = mu == 1 ? primal_ : new K[mu * Subdomain<K>::dof_];
+                    K** dual = dual_;
+                    if(mu > 1)
+                        allocateSingle(dual, mu);
                     if(trans == 'T')
-                        precond(in, dual_);
+                        precond(in, dual, mu);
                     if(super::ev_) {
                         if(trans == 'T')
-                            A<'T', 0>(primal_, dual_);
+                            A<'T', 0>(primal, dual, mu, Subdomain<K>::dof_);
                         else
-                            A<'T', 0>(primal_, in);
+                            A<'T', 0>(primal, in, mu, Subdomain<K>::dof_);
                         if(super::schur_) {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), primal_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
-                            super::co_->template callSolver<excluded>(super::uc_);
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);
+                            Blas<K>::gemm(&(Wrapper<K>::transc), "N", super::co_->getAddrLocal(), &n, &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), primal, &(Subdomain<K>::dof_), &(Wrapper<K>::d__0), super::uc_, super::co_->getAddrLocal());
+                            super::co_->template callSolver<excluded>(super::uc_, mu);
+                            Blas<K>::gemm("N", "N", &(Subdomain<K>::dof_), &n, super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, super::co_->getAddrLocal(), &(Wrapper<K>::d__0), primal, &(Subdomain<K>::dof_));
                         }
                         else {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), primal_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);
-                            super::co_->template callSolver<excluded>(super::uc_);
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);
+                            Blas<K>::gemm(&(Wrapper<K>::transc), "N", super::co_->getAddrLocal(), &n, &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), primal, &(Subdomain<K>::dof_), &(Wrapper<K>::d__0), super::uc_, super::co_->getAddrLocal());
+                            super::co_->template callSolver<excluded>(super::uc_, mu);
+                            Blas<K>::gemm("N", "N", &(Subdomain<K>::dof_), &n, super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), super::uc_, super::co_->getAddrLocal(), &(Wrapper<K>::d__0), primal, &(Subdomain<K>::dof_));
                         }
                     }
                     else {
-                        super::co_->template callSolver<excluded>(super::uc_);
-                        std::fill_n(primal_, Subdomain<K>::dof_, K());
+                        super::co_->template callSolver<excluded>(super::uc_, mu);
+                        std::fill_n(primal, mu * Subdomain<K>::dof_, K());
                     }
-                    A<'N', 0>(primal_, dual_);
+                    A<'N', 0>(primal, dual, mu, Subdomain<K>::dof_);
                     if(trans == 'N')
-                        precond(dual_);
+                        precond(dual, nullptr, mu);
+                    const int size = mu * super::mult_;
                     if(out)
-                        for(unsigned int i = 0; i < super::mult_; ++i)
-                            (*out)[i] = (*in)[i] - (*dual_)[i];
+                        for(int i = 0; i < size; ++i)
+                            (*out)[i] = (*in)[i] - (*dual)[i];
                     else
-                        Blas<K>::axpy(&(super::mult_), &(Wrapper<K>::d__2), *dual_, &i__1, *in, &i__1);
+                        Blas<K>::axpy(&size, &(Wrapper<K>::d__2), *dual, &i__1, *in, &i__1);
+                    if(mu > 1) {
+                        delete [] *dual;
+                        delete [] dual;
+                        delete [] primal;
+                    }
                 }
                 else
-                    super::co_->template callSolver<excluded>(super::uc_);
+                    super::co_->template callSolver<excluded>(super::uc_, mu);
             }
             else if(!excluded && out)
-                std::copy_n(*in, super::mult_, *out);
+                std::copy_n(*in, mu * super::mult_, *out);
         }
         /* Function: buildTwo
          *
@@ -394,45 +500,19 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
          *
          * Parameters:
-         *    l              - Last iterate of the Lagrange multiplier.
-         *    x              - Solution vector. */
+         *    l              - Last iterate(s) of the Lagrange multiplier(s).
+         *    x              - Solution vector(s).
+         *    mu             - Number of right-hand sides. */
         template<bool excluded>
-        void computeSolution(K* const* const l, K* const x) const {
-            if(!excluded) {
-                A<'T', 0>(primal_, l);                                                                                                                                                                                                                   //    primal_ = A^T l
-                std::fill_n(super::structure_, super::bi_->m_, K());
-                static_cast<Solver<K>*>(super::pinv_)->solve(super::structure_);                                                                                                                                                                         // structure_ = S \ A^T l
-                Blas<K>::axpy(&(Subdomain<K>::a_->n_), &(Wrapper<K>::d__2), super::structure_, &i__1, x, &i__1);                                                                                                                                         //          x = x - S \ A^T l
-                if(super::co_) {
-                    A<'N', 0>(x + super::bi_->m_, dual_);                                                                                                                                                                                                //      dual_ = A (x - S \ A^T l)
-                    precond(dual_);                                                                                                                                                                                                                      //      dual_ = Q A (x - S \ A^T l)
-                    if(!super::ev_)
-                        super::co_->template callSolver<excluded>(super::uc_);
-                    else {
-                        A<'T', 0>(primal_, dual_);                                                                                                                                                                                                       //    primal_ = A^T Q A (x - S \ A^T l)
-                        if(super::schur_) {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), primal_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1);                    //        uc_ = R_b^T A^T Q A (x - S \ A^T l)
-                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                       //        uc_ = (G Q G^T) \ R_b^T A^T Q A (x - S \ A^T l)
-                            Blas<K>::gemv("N", &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, &i__1, &(Wrapper<K>::d__0), primal_, &i__1);                                      //        x_b = x_b - R_b^T (G Q G^T) \ R_b^T A^T Q A (x - S \ A^T l)
-                            Wrapper<K>::template csrmv<Wrapper<K>::I>(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), &(super::bi_->m_), &(Wrapper<K>::d__2), false, super::bi_->a_, super::bi_->ia_, super::bi_->ja_, primal_, &(Wrapper<K>::d__0), super::work_);
-                            if(super::bi_->m_)
-                                super::s_.solve(super::work_);
-                            Blas<K>::axpy(&(super::bi_->m_), &(Wrapper<K>::d__2), super::work_, &i__1, x, &i__1);
-                            Blas<K>::axpy(&(Subdomain<K>::dof_), &(Wrapper<K>::d__2), primal_, &i__1, x + super::bi_->m_, &i__1);
-                        }
-                        else {
-                            Blas<K>::gemv(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), super::co_->getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_ + super::bi_->m_, &(Subdomain<K>::a_->n_), primal_, &i__1, &(Wrapper<K>::d__0), super::uc_, &i__1); //       uc_ = R A^T Q A (x - S \ A^T l)
-                            super::co_->template callSolver<excluded>(super::uc_);                                                                                                                                                                       //       uc_ = (G Q G^T) \ R A^T Q A (x - S \ A^T l)
-                            Blas<K>::gemv("N", &(Subdomain<K>::a_->n_), super::co_->getAddrLocal(), &(Wrapper<K>::d__2), *super::ev_, &(Subdomain<K>::a_->n_), super::uc_, &i__1, &(Wrapper<K>::d__1), x, &i__1);                                        //         x = x - R^T (G Q G^T) \ R A^T Q A (x - S \ A^T l)
-                        }
-                    }
-                }
+        void computeSolution(K* const* const l, K* const x, const unsigned short& mu = 1) const {
+            std::vector<K*> lambda;
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                view(lambda, l, nu);
+                recoverSolution<excluded>(lambda.data(), x + nu * Subdomain<K>::a_->n_);
             }
-            else if(super::co_)
-                super::co_->template callSolver<excluded>(super::uc_);
         }
         template<bool>
-        void computeSolution(const K* const, K* const) const { }
+        void computeSolution(const K* const, K* const, const unsigned short& = 1) const { }
         /* Function: computeDot
          *
          *  Computes the dot product of two Lagrange multipliers.
@@ -441,15 +521,20 @@ class Feti : public Schur<Solver, CoarseOperator<CoarseSolver, S, K>, K> {
          *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
          *
          * Parameters:
-         *    a              - Left-hand side.
-         *    b              - Right-hand side. */
+         *    val            - Dot product(s).
+         *    a              - Left-hand side(s).
+         *    b              - Right-hand side(s).
+         *    comm           - Global MPI communicator.
+         *    mu             - Number of dot products. */
         template<bool excluded>
-        void computeDot(underlying_type<K>* const val, const K* const* const a, const K* const* const b, const MPI_Comm& comm) const {
-            if(!excluded)
-                *val = std::real(Blas<K>::dot(&(super::mult_), *a, &i__1, *b, &i__1)) / 2.0;
-            else
-                *val = 0.0;
-            MPI_Allreduce(MPI_IN_PLACE, val, 1, Wrapper<K>::mpi_underlying_type(), MPI_SUM, comm);
+        void computeDot(underlying_type<K>* const val, const K* const* const a, const K* const* const b, const MPI_Comm& comm, const unsigned short& mu = 1) const {
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                if(!excluded)
+                    val[nu] = std::real(Blas<K>::dot(&(super::mult_), *a + nu * super::mult_, &i__1, *b + nu * super::mult_, &i__1)) / 2.0;
+                else
+                    val[nu] = 0.0;
+            }
+            MPI_Allreduce(MPI_IN_PLACE, val, mu, Wrapper<K>::mpi_underlying_type(), MPI_SUM, comm);
         }
         /* Function: getScaling
          *  Returns a constant pointer to <Feti::m>. */
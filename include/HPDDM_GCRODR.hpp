@@ -55,10 +55,6 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
     }
     const int n = excluded ? 0 : A.getDof();
     const int ldh = mu * (m[0] + 1);
-    K** const H = new K*[m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 4 : 3) + 1];
-    K** const save = H + m[0];
-    *save = new K[ldh * m[0]];
-    K** const v = save + m[0];
     const underlying_type<K>* const d = reinterpret_cast<const underlying_type<K>*>(A.getScaling());
     const int ldv = mu * n;
     K* U = reinterpret_cast<K*>(A.storage()), *C = nullptr;
@@ -67,7 +63,15 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
         k = (storage.first >= mu ? storage.second : (storage.second * storage.first) / mu);
         C = U + storage.first * storage.second * n;
     }
-    K* const s = new K[mu * ((m[0] + 1) * (m[0] + 1) + n * ((id[1] == HPDDM_VARIANT_RIGHT ? 3 : 2) + m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1)) + (!Wrapper<K>::is_complex ? m[0] + 1 : (m[0] + 2) / 2)) + (d && U && id[1] == HPDDM_VARIANT_RIGHT && id[4] / 4 == 0 ? n * std::max(k - mu * (m[0] - k + 2), 0) : 0)];
+    const int sizeH = m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 4 : 3) + 1;
+    const int size = mu * ((m[0] + 1) * (m[0] + 1) + n * ((id[1] == HPDDM_VARIANT_RIGHT ? 3 : 2) + m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1)) + (!Wrapper<K>::is_complex ? m[0] + 1 : (m[0] + 2) / 2)) + (d && U && id[1] == HPDDM_VARIANT_RIGHT && id[4] / 4 == 0 ? n * std::max(k - mu * (m[0] - k + 2), 0) : 0);
+    const int sizeG = ((id[2] & 3) == HPDDM_ORTHOGONALIZATION_SRCGS ? mu * ((m[0] + 1) * (m[0] + 1) + 2 * m[0] + 1) : 0);
+    char* pool = A.template workspace<char>(bytes<K*>(sizeH) + bytes<K>(ldh * m[0]) + bytes<K>(size) + bytes<short>(mu) + bytes<K>(sizeG));
+    K** const H = carve<K*>(pool, sizeH);
+    K** const save = H + m[0];
+    *save = carve<K>(pool, ldh * m[0]);
+    K** const v = save + m[0];
+    K* const s = carve<K>(pool, size);
     *H = s + ldh;
     for(unsigned short i = 1; i < m[0]; ++i) {
         H[i] = *H + i * ldh;
@@ -77,8 +81,9 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
     for(unsigned short i = 1; i < m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1; ++i)
         v[i] = *v + i * ldv;
     K* const Ax = *v + (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1) * ldv;
-    short* const hasConverged = new short[mu];
+    short* const hasConverged = carve<short>(pool, mu);
     std::fill_n(hasConverged, mu, -m[0]);
+    K* const G = sizeG ? carve<K>(pool, sizeG) : nullptr;
     int info;
     HPDDM_IT(j, A) = 1;
     underlying_type<K>* const norm = reinterpret_cast<underlying_type<K>*>(Ax + (id[1] == HPDDM_VARIANT_RIGHT ? 2 : 1) * ldv + (d && U && id[1] == HPDDM_VARIANT_RIGHT && id[4] / 4 == 0 ? n * std::max(k - mu * (m[0] - k + 2), 0) : 0));
@@ -151,7 +156,7 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
             for(unsigned short nu = 0; nu < mu; ++nu)
                 sn[nu] = HPDDM::real(Blas<K>::dot(&n, v[i] + nu * n, &i__1, v[i] + nu * n, &i__1));
         if(HPDDM_IT(j, A) == 1) {
-            MPI_Allreduce(MPI_IN_PLACE, norm, 2 * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+            allreduce(norm, 2 * mu, comm);
             for(unsigned short nu = 0; nu < mu; ++nu) {
                 norm[nu] = HPDDM::sqrt(norm[nu]);
                 if(norm[nu] < underlying_type<K>(HPDDM_EPS))
@@ -172,7 +177,7 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
             }
         }
         else
-            MPI_Allreduce(MPI_IN_PLACE, sn, mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+            allreduce(sn, mu, comm);
         for(unsigned short nu = 0; nu < mu; ++nu) {
             if(hasConverged[nu] > 0)
                 hasConverged[nu] = 0;
@@ -215,7 +220,7 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
                 PetscCall(PetscLogEventEnd(KSP_GMRESOrthogonalization, A.ksp_, nullptr, nullptr, nullptr));
 #endif
             }
-            Arnoldi<excluded>(id[2], m[0], H, v, s, sn, n, i++, mu, d, Ax, comm, save, U ? k : 0);
+            Arnoldi<excluded>(id[2], m[0], H, v, s, sn, n, i++, mu, d, Ax, comm, save, U ? k : 0, G);
             checkConvergence<4>(id[0], HPDDM_IT(j, A), i, HPDDM_TOL(tol, A), mu, norm, s + i * mu, hasConverged, m[0]);
 #if HPDDM_PETSC
             A.ksp_->rnorm = static_cast<PetscReal>(HPDDM::abs(*std::max_element(s + i * mu, s + (i + 1) * mu, [](const K& lhs, const K& rhs) { return HPDDM::abs(lhs) < HPDDM::abs(rhs); })));
@@ -354,7 +359,7 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
                 if(excluded || !n) {
                     if(id[4] % 4 != HPDDM_RECYCLE_STRATEGY_B) {
                         std::fill_n(prod, k * active * (m[0] + 2), K());
-                        MPI_Allreduce(MPI_IN_PLACE, prod, k * active * (m[0] + 2), Wrapper<K>::mpi_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+                        allreduce(prod, k * active * (m[0] + 2), comm);
                     }
                 }
                 else {
@@ -377,7 +382,7 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
                                     prod[k * active * info + k * nu + i] = Blas<K>::dot(&n, U + activeSet[nu] * n + i * ldv, &i__1, U + activeSet[nu] * n + i * ldv, &i__1);
                             }
                         }
-                        MPI_Allreduce(MPI_IN_PLACE, prod, k * active * (m[0] + 2), Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(prod, k * active * (m[0] + 2), comm);
                         std::for_each(prod + k * active * (m[0] + 1), prod + k * active * (m[0] + 2), [](K& u) { u = underlying_type<K>(1.0) / HPDDM::sqrt(HPDDM::real(u)); });
                     }
                     for(unsigned short nu = 0; nu < active; ++nu) {
@@ -486,11 +491,7 @@ inline int IterativeMethod::GCRODR(const Operator& A, const K* const b, K* const
         (*Option::get())[A.prefix("recycle_same_system")] += 1;
     convergence<4>(id[0], HPDDM_IT(j, A), HPDDM_MAX_IT(m[1], A));
 #endif
-    delete [] hasConverged;
     A.end(allocate);
-    delete [] s;
-    delete [] *save;
-    delete [] H;
     return HPDDM_RET(std::min(HPDDM_IT(j, A), HPDDM_MAX_IT(m[1], A)));
 }
 template<bool excluded, class Operator, class K>
@@ -516,10 +517,6 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
     }
     const int n = excluded ? 0 : A.getDof();
     int ldh = mu * (m[0] + 1);
-    K** const H = new K*[m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 4 : 3) + 1];
-    K** const save = H + m[0];
-    *save = new K[ldh * mu * m[0]]();
-    K** const v = save + m[0];
     int info;
     int N = 2 * mu;
     const underlying_type<K>* const d = reinterpret_cast<const underlying_type<K>*>(A.getScaling());
@@ -537,7 +534,15 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
         }
     }
     int lwork = mu * (d ? (n + (id[1] == HPDDM_VARIANT_RIGHT ? std::max(n, ldh) : ldh)) : std::max((id[1] == HPDDM_VARIANT_RIGHT ? 2 : 1) * n, ldh));
-    *H = new K[lwork + (d && U && id[1] == HPDDM_VARIANT_RIGHT && id[4] / 4 == 0 ? mu * n * std::max(2 * k - m[0] - 2, 0) : 0) + mu * ((m[0] + 1) * ldh + n * (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1) + 2 * m[0]) + (Wrapper<K>::is_complex ? (mu + 1) / 2 : mu)];
+    const int sizeH = m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 4 : 3) + 1;
+    const int size = lwork + (d && U && id[1] == HPDDM_VARIANT_RIGHT && id[4] / 4 == 0 ? mu * n * std::max(2 * k - m[0] - 2, 0) : 0) + mu * ((m[0] + 1) * ldh + n * (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1) + 2 * m[0]) + (Wrapper<K>::is_complex ? (mu + 1) / 2 : mu);
+    char* pool = A.template workspace<char>(bytes<K*>(sizeH) + bytes<K>(ldh * mu * m[0]) + bytes<K>(size) + bytes<int>(mu));
+    K** const H = carve<K*>(pool, sizeH);
+    K** const save = H + m[0];
+    *save = carve<K>(pool, ldh * mu * m[0]);
+    std::fill_n(*save, ldh * mu * m[0], K());
+    K** const v = save + m[0];
+    *H = carve<K>(pool, size);
     *v = *H + m[0] * mu * ldh;
     K* const Ax = *v + ldv * (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1);
     K* const s = Ax + lwork + (d && U && id[1] == HPDDM_VARIANT_RIGHT && id[4] / 4 == 0 ? mu * n * std::max(2 * k - m[0] - 2, 0) : 0);
@@ -553,7 +558,7 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
     }
     HPDDM_IT(j, A) = 1;
     short dim = mu * m[0];
-    int* const piv = new int[mu];
+    int* const piv = carve<int>(pool, mu);
     int deflated = -1;
     while(HPDDM_IT(j, A) <= HPDDM_MAX_IT(m[2], A)) {
         if(!excluded) {
@@ -844,11 +849,11 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
                 if(excluded || !n) {
                     if(symmetric) {
                         prod = new K[bK * bK]();
-                        MPI_Allreduce(MPI_IN_PLACE, prod, bK * bK, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(prod, bK * bK, comm);
                     }
                     else if(id[4] % 4 != HPDDM_RECYCLE_STRATEGY_B) {
                         std::fill_n(prod, bK * (dim + deflated + 1), K());
-                        MPI_Allreduce(MPI_IN_PLACE, prod, bK * (dim + deflated + 1), Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(prod, bK * (dim + deflated + 1), comm);
                     }
                 }
                 else {
@@ -872,7 +877,7 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
                             for(unsigned short nu = 0; nu < bK; ++nu)
                                 prod[bK * (dim + deflated) + nu] = Blas<K>::dot(&n, U + nu * n, &i__1, U + nu * n, &i__1);
                         }
-                        MPI_Allreduce(MPI_IN_PLACE, prod, bK * (dim + deflated + 1), Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(prod, bK * (dim + deflated + 1), comm);
                         for(unsigned short nu = 0; nu < bK; ++nu) {
                             prod[bK * (dim + deflated) + nu] = underlying_type<K>(1.0) / HPDDM::sqrt(HPDDM::real(prod[bK * (dim + deflated) + nu]));
                             Blas<K>::scal(&n, prod + bK * (dim + deflated) + nu, U + nu * n, &i__1);
@@ -918,7 +923,7 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
                             else {
                                 Blas<K>::gemm(&(Wrapper<K>::transc), "N", &bK, &bK, &n, &(Wrapper<K>::d__1), U, &n, U, &n, &(Wrapper<K>::d__0), B, &bK);
                             }
-                            MPI_Allreduce(MPI_IN_PLACE, B, bK * bK, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                            allreduce(B, bK * bK, comm);
                             Wrapper<K>::template imatcopy<'N'>(bK, bK, B, bK, dim);
                             for(i = 0; i < bK; ++i)
                                 std::fill(B + bK + i * dim, B + (i + 1) * dim, K());
@@ -1005,11 +1010,7 @@ inline int IterativeMethod::BGCRODR(const Operator& A, const K* const b, K* cons
     if(HPDDM_IT(j, A) != 0 && HPDDM_IT(j, A) != HPDDM_MAX_IT(m[2], A) + 1 && id[4] / 4)
         (*Option::get())[A.prefix("recycle_same_system")] += 1;
 #endif
-    delete [] piv;
     A.end(allocate);
-    delete [] *H;
-    delete [] *save;
-    delete [] H;
     if(HPDDM_IT(j, A) != 0 || deflated == -1) {
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
         convergence<5>(id[0], HPDDM_IT(j, A), HPDDM_MAX_IT(m[2], A));
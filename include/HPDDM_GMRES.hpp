@@ -34,14 +34,25 @@ inline int IterativeMethod::GMRES(const Operator& A, const K* const b, K* const
     unsigned short j, m[2];
     char id[3];
     options<0>(A, &tol, nullptr, m, id);
+    const int t = id[1] == HPDDM_VARIANT_FLEXIBLE ? 1 : std::min(A.snapshot().gmres_s_step_, m[0]);
+    if(t > 1 && (id[2] & 3) == HPDDM_ORTHOGONALIZATION_SRCGS) {
+        if(id[0])
+            std::cout << "WARNING -- single-reduction Gram--Schmidt is not implemented for s-step GMRES, now switching to cgs" << std::endl;
+        id[2] += HPDDM_ORTHOGONALIZATION_CGS - HPDDM_ORTHOGONALIZATION_SRCGS;
+    }
 #else
     unsigned short* m = reinterpret_cast<KSP_HPDDM*>(A.ksp_->data)->scntl;
     char* id = reinterpret_cast<KSP_HPDDM*>(A.ksp_->data)->cntl;
+    constexpr int t = 1;
 #endif
     const int n = excluded ? 0 : A.getDof();
-    K** const H = new K*[m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 3 : 2) + 1];
+    const int size = mu * ((m[0] + 1) * (m[0] + 1) + n * (2 + m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1)) + (!Wrapper<K>::is_complex ? m[0] + 1 : (m[0] + 2) / 2));
+    const int sizeG = ((id[2] & 3) == HPDDM_ORTHOGONALIZATION_SRCGS ? mu * ((m[0] + 1) * (m[0] + 1) + 2 * m[0] + 1) : 0);
+    const int sizeSave = (t > 1 ? mu * ((m[0] + 1) * m[0] + t * (n + t + 1) + (m[0] + t) * t) + (m[0] + 2 * t) * t : 0);
+    char* pool = A.template workspace<char>(bytes<K*>(m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 3 : 2) + 1) + bytes<K>(size) + bytes<short>(mu) + bytes<K>(sizeG) + (t > 1 ? bytes<K*>(m[0]) + bytes<K>(sizeSave) : 0));
+    K** const H = carve<K*>(pool, m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 3 : 2) + 1);
     K** const v = H + m[0];
-    K* const s = new K[mu * ((m[0] + 1) * (m[0] + 1) + n * (2 + m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1)) + (!Wrapper<K>::is_complex ? m[0] + 1 : (m[0] + 2) / 2))];
+    K* const s = carve<K>(pool, size);
     K* const Ax = s + mu * (m[0] + 1);
     *H = Ax + mu * n;
     for(unsigned short i = 1; i < m[0]; ++i)
@@ -52,8 +63,20 @@ inline int IterativeMethod::GMRES(const Operator& A, const K* const b, K* const
     underlying_type<K>* const norm = reinterpret_cast<underlying_type<K>*>(*v + (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1) * mu * n);
     underlying_type<K>* const sn = norm + mu;
     const underlying_type<K>* const d = reinterpret_cast<const underlying_type<K>*>(A.getScaling());
-    short* const hasConverged = new short[mu];
+    short* const hasConverged = carve<short>(pool, mu);
     std::fill_n(hasConverged, mu, -m[0]);
+    K* const G = sizeG ? carve<K>(pool, sizeG) : nullptr;
+    K** const save = t > 1 ? carve<K*>(pool, m[0]) : nullptr;
+    K* theta = nullptr, *work = nullptr, *scratch = nullptr;
+    bool ready = false;
+    if(t > 1) {
+        *save = carve<K>(pool, sizeSave);
+        for(unsigned short i = 1; i < m[0]; ++i)
+            save[i] = *save + i * mu * (m[0] + 1);
+        theta = *save + m[0] * mu * (m[0] + 1);
+        work = theta + mu * t;
+        scratch = work + mu * t * (n + t);
+    }
     bool allocate;
     HPDDM_CALL(initializeNorm<excluded>(A, id[1], b, x, *v, n, Ax, norm, mu, 1, allocate));
     HPDDM_IT(j, A) = 1;
@@ -73,7 +96,7 @@ inline int IterativeMethod::GMRES(const Operator& A, const K* const b, K* const
             for(unsigned short nu = 0; nu < mu; ++nu)
                 sn[nu] = HPDDM::real(Blas<K>::dot(&n, *v + nu * n, &i__1, *v + nu * n, &i__1));
         if(HPDDM_IT(j, A) == 1) {
-            MPI_Allreduce(MPI_IN_PLACE, norm, 2 * mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+            allreduce(norm, 2 * mu, comm);
             for(unsigned short nu = 0; nu < mu; ++nu) {
                 norm[nu] = HPDDM::sqrt(norm[nu]);
                 if(norm[nu] < underlying_type<K>(HPDDM_EPS))
@@ -85,7 +108,7 @@ inline int IterativeMethod::GMRES(const Operator& A, const K* const b, K* const
             }
         }
         else
-            MPI_Allreduce(MPI_IN_PLACE, sn, mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
+            allreduce(sn, mu, comm);
         if(HPDDM_IT(j, A) == 0) {
 #if HPDDM_PETSC
             PetscCall(KSPLogResidualHistory(A.ksp_, PetscReal()));
@@ -108,43 +131,66 @@ inline int IterativeMethod::GMRES(const Operator& A, const K* const b, K* const
             PetscCall(KSPMonitor(A.ksp_, 0, A.ksp_->rnorm));
             PetscCall((*A.ksp_->converged)(A.ksp_, 0, A.ksp_->rnorm, &A.ksp_->reason, A.ksp_->cnvP));
             if(A.ksp_->reason) {
-                delete [] hasConverged;
                 A.end(allocate);
-                delete [] s;
-                delete [] H;
                 return 0;
             }
         }
 #endif
         unsigned short i = 0;
         while(i < m[0] && HPDDM_IT(j, A) <= HPDDM_MAX_IT(m[1], A)) {
-            if(id[1] == HPDDM_VARIANT_LEFT) {
-                if(!excluded)
-                    HPDDM_CALL(A.GMV(v[i], Ax, mu));
-                HPDDM_CALL(A.template apply<excluded>(Ax, v[i + 1], mu));
+            const bool block = ready && i + t <= m[0] && HPDDM_IT(j, A) + t - 1 <= HPDDM_MAX_IT(m[1], A);
+            for(unsigned short l = i; l < i + (block ? t : 1); ++l) {
+                if(id[1] == HPDDM_VARIANT_LEFT) {
+                    if(!excluded)
+                        HPDDM_CALL(A.GMV(v[l], Ax, mu));
+                    HPDDM_CALL(A.template apply<excluded>(Ax, v[l + 1], mu));
+                }
+                else {
+                    HPDDM_CALL(A.template apply<excluded>(v[l], id[1] == HPDDM_VARIANT_FLEXIBLE ? v[l + m[0] + 1] : Ax, mu, v[l + 1]));
+                    if(!excluded)
+                        HPDDM_CALL(A.GMV(id[1] == HPDDM_VARIANT_FLEXIBLE ? v[l + m[0] + 1] : Ax, v[l + 1], mu));
+                }
+                if(block && !excluded)
+                    for(unsigned short nu = 0; nu < mu; ++nu) {
+                        const K alpha = -theta[nu * t + l - i];
+                        Blas<K>::axpy(&n, &alpha, v[l] + nu * n, &i__1, v[l + 1] + nu * n, &i__1);
+                    }
             }
-            else {
-                HPDDM_CALL(A.template apply<excluded>(v[i], id[1] == HPDDM_VARIANT_FLEXIBLE ? v[i + m[0] + 1] : Ax, mu, v[i + 1]));
-                if(!excluded)
-                    HPDDM_CALL(A.GMV(id[1] == HPDDM_VARIANT_FLEXIBLE ? v[i + m[0] + 1] : Ax, v[i + 1], mu));
+            unsigned short r = 0;
+            if(block && !(r = sStepArnoldi<excluded>(id[2], m[0], H, v, save, theta, n, i, t, mu, d, work, scratch, comm))) {
+                ready = false;
+                continue;
             }
-            Arnoldi<excluded>(id[2], m[0], H, v, s, sn, n, i++, mu, d, Ax, comm);
-            checkConvergence<0>(id[0], HPDDM_IT(j, A), i, HPDDM_TOL(tol, A), mu, norm, s + i * mu, hasConverged, m[0]);
+            if(!r) {
+                Arnoldi<excluded>(id[2], m[0], H, v, s, sn, n, i, mu, d, Ax, comm, save, 0, G);
+                if(theta && !ready && i + 1 == t)
+                    ready = NewtonShifts(m[0], save, t, mu, theta, scratch);
+            }
+            bool converged = false;
+            for(unsigned short c = 0; c < (r ? r : 1) && !converged; ++c) {
+                if(r)
+                    GivensRotations(m[0], H, s, sn, i, mu);
+                ++i;
+                checkConvergence<0>(id[0], HPDDM_IT(j, A), i, HPDDM_TOL(tol, A), mu, norm, s + i * mu, hasConverged, m[0]);
 #if HPDDM_PETSC
-            A.ksp_->rnorm = static_cast<PetscReal>(HPDDM::abs(*std::max_element(s + i * mu, s + (i + 1) * mu, [](const K& lhs, const K& rhs) { return HPDDM::abs(lhs) < HPDDM::abs(rhs); })));
-            PetscCall(KSPLogResidualHistory(A.ksp_, A.ksp_->rnorm));
-            PetscCall(KSPMonitor(A.ksp_, HPDDM_IT(j, A), A.ksp_->rnorm));
-            PetscCall((*A.ksp_->converged)(A.ksp_, HPDDM_IT(j, A), A.ksp_->rnorm, &A.ksp_->reason, A.ksp_->cnvP));
-            if(A.ksp_->reason)
-                std::for_each(hasConverged, hasConverged + mu, [&](short& c) { if(c == -m[0]) c = i; });
-            else if(A.ksp_->converged == KSPConvergedSkip)
-                std::fill_n(hasConverged, mu, -m[0]);
+                A.ksp_->rnorm = static_cast<PetscReal>(HPDDM::abs(*std::max_element(s + i * mu, s + (i + 1) * mu, [](const K& lhs, const K& rhs) { return HPDDM::abs(lhs) < HPDDM::abs(rhs); })));
+                PetscCall(KSPLogResidualHistory(A.ksp_, A.ksp_->rnorm));
+                PetscCall(KSPMonitor(A.ksp_, HPDDM_IT(j, A), A.ksp_->rnorm));
+                PetscCall((*A.ksp_->converged)(A.ksp_, HPDDM_IT(j, A), A.ksp_->rnorm, &A.ksp_->reason, A.ksp_->cnvP));
+                if(A.ksp_->reason)
+                    std::for_each(hasConverged, hasConverged + mu, [&](short& c) { if(c == -m[0]) c = i; });
+                else if(A.ksp_->converged == KSPConvergedSkip)
+                    std::fill_n(hasConverged, mu, -m[0]);
 #endif
-            if(std::find(hasConverged, hasConverged + mu, -m[0]) == hasConverged + mu) {
+                if(std::find(hasConverged, hasConverged + mu, -m[0]) == hasConverged + mu)
+                    converged = true;
+                else
+                    ++HPDDM_IT(j, A);
+            }
+            if(converged) {
                 i = 0;
                 break;
             }
-            ++HPDDM_IT(j, A);
         }
         if(HPDDM_IT(j, A) != HPDDM_MAX_IT(m[1], A) + 1 && i == m[0]) {
             HPDDM_CALL(updateSol<excluded>(A, id[1], n, x, H, s, v + (id[1] == HPDDM_VARIANT_FLEXIBLE ? m[0] + 1 : 0), hasConverged, mu, Ax));
@@ -162,10 +208,7 @@ inline int IterativeMethod::GMRES(const Operator& A, const K* const b, K* const
     }
     HPDDM_CALL(updateSol<excluded>(A, id[1], n, x, H, s, v + (id[1] == HPDDM_VARIANT_FLEXIBLE ? m[0] + 1 : 0), hasConverged, mu, Ax));
     convergence<0>(id[0], HPDDM_IT(j, A), HPDDM_MAX_IT(m[1], A));
-    delete [] hasConverged;
     A.end(allocate);
-    delete [] s;
-    delete [] H;
     return HPDDM_RET(std::min(HPDDM_IT(j, A), HPDDM_MAX_IT(m[1], A)));
 }
 template<bool excluded, class Operator, class K>
@@ -181,14 +224,17 @@ inline int IterativeMethod::BGMRES(const Operator& A, const K* const b, K* const
     char* id = reinterpret_cast<KSP_HPDDM*>(A.ksp_->data)->cntl;
 #endif
     const int n = excluded ? 0 : A.getDof();
-    K** const H = new K*[m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 3 : 2) + 1];
-    K** const v = H + m[0];
+    const int sizeH = m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 3 : 2) + 1;
     int ldh = mu * (m[0] + 1);
     int info;
     int N = 2 * mu;
     const underlying_type<K>* const d = reinterpret_cast<const underlying_type<K>*>(A.getScaling());
     int lwork = mu * (d ? n + ldh : std::max(n, ldh));
-    *H = new K[lwork + mu * ((m[0] + 1) * ldh + n * (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1) + 2 * m[0]) + (Wrapper<K>::is_complex ? (mu + 1) / 2 : mu)];
+    const int size = lwork + mu * ((m[0] + 1) * ldh + n * (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1) + 2 * m[0]) + (Wrapper<K>::is_complex ? (mu + 1) / 2 : mu);
+    char* pool = A.template workspace<char>(bytes<K*>(sizeH) + bytes<K>(size) + bytes<int>(mu));
+    K** const H = carve<K*>(pool, sizeH);
+    K** const v = H + m[0];
+    *H = carve<K>(pool, size);
     *v = *H + m[0] * mu * ldh;
     K* const s = *v + mu * n * (m[0] * (id[1] == HPDDM_VARIANT_FLEXIBLE ? 2 : 1) + 1);
     K* const tau = s + mu * ldh;
@@ -204,7 +250,7 @@ inline int IterativeMethod::BGMRES(const Operator& A, const K* const b, K* const
     }
     HPDDM_IT(j, A) = 1;
     short dim = mu * m[0];
-    int* const piv = new int[mu];
+    int* const piv = carve<int>(pool, mu);
     int deflated = -1;
     while(HPDDM_IT(j, A) <= HPDDM_MAX_IT(m[2], A)) {
         if(!excluded)
@@ -328,10 +374,7 @@ inline int IterativeMethod::BGMRES(const Operator& A, const K* const b, K* const
         if(tol[0] > static_cast<typename std::remove_reference<decltype(*tol)>::type>(-0.9))
             Lapack<K>::lapmt(&i__0, &n, &mu, x, &n, piv);
     }
-    delete [] piv;
     A.end(allocate);
-    delete [] *H;
-    delete [] H;
     if(HPDDM_IT(j, A) != 0 || deflated == -1) {
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
         convergence<1>(id[0], HPDDM_IT(j, A), HPDDM_MAX_IT(m[2], A));
@@ -0,0 +1,343 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPDDM_ILU_HPP_
+#define HPDDM_ILU_HPP_
+
+#ifdef ILUSUB
+#undef HPDDM_CHECK_COARSEOPERATOR
+#define HPDDM_CHECK_SUBDOMAIN
+#include "HPDDM_preprocessor_check.hpp"
+#define SUBDOMAIN HPDDM::IluSub
+#endif
+
+namespace HPDDM {
+/* Class: Ilu Sub
+ *
+ *  A class for computing inexact solutions of local systems with incomplete factorizations.
+ *  Unsymmetric matrices are factorized as ILU(k), and symmetric matrices as IC(k), i.e., LDL<sup>H</sup> when <Option> operator_spd is set and LDL<sup>T</sup> otherwise, where k is the level of fill set by <Option> ilu_fill_level.
+ *  The pattern of the factors is computed once per sparsity pattern, and triangular solves are scheduled by levels, so that rows of a same level may be processed concurrently.
+ *
+ * Template Parameter:
+ *    K              - Scalar type. */
+template<class K>
+class IluSub {
+    private:
+        /* Variable: a
+         *  Values of the factors, with the diagonal of U or D stored in place of the unit diagonal of L. */
+        std::vector<K>             a_;
+        /* Variable: ia
+         *  Row pointers of the factors, only the lower triangular part is stored for symmetric matrices. */
+        std::vector<int>          ia_;
+        std::vector<int>          ja_;
+        /* Variable: diag
+         *  Positions of the diagonal entries in <Ilu Sub::ja>. */
+        std::vector<int>        diag_;
+        /* Variable: map
+         *  Position of each nonzero of the input matrix in <Ilu Sub::a>. */
+        std::vector<int>         map_;
+        /* Variable: tia
+         *  Row pointers of the transpose of the strictly lower triangular factor of symmetric matrices. */
+        std::vector<int>         tia_;
+        std::vector<int>         tja_;
+        /* Variable: tpos
+         *  Positions in <Ilu Sub::a> of the entries of the transpose. */
+        std::vector<int>        tpos_;
+        /* Variable: forward
+         *  Rows sorted by levels of the forward substitution. */
+        std::vector<int>     forward_;
+        std::vector<int>    flevels_;
+        /* Variable: backward
+         *  Rows sorted by levels of the backward substitution. */
+        std::vector<int>    backward_;
+        std::vector<int>    blevels_;
+        std::size_t             hash_;
+        int                        n_;
+        int                      nnz_;
+        int                     fill_;
+        /* Variable: replaced
+         *  Number of vanishing pivots replaced during the last factorization. */
+        int                 replaced_;
+        bool                     sym_;
+        bool                    conj_;
+        /* Function: schedule
+         *  Sorts rows by levels, given the dependencies of each row. */
+        template<class It>
+        void schedule(std::vector<int>& order, std::vector<int>& levels, bool descending, It deps) {
+            std::vector<int> level(n_, 0);
+            int max = 0;
+            for(int k = 0; k < n_; ++k) {
+                const int i = descending ? n_ - 1 - k : k;
+                int l = 0;
+                deps(i, [&](int j) { l = std::max(l, level[j] + 1); });
+                level[i] = l;
+                max = std::max(max, l);
+            }
+            levels.assign(max + 2, 0);
+            for(int i = 0; i < n_; ++i)
+                ++levels[level[i] + 1];
+            std::partial_sum(levels.cbegin(), levels.cend(), levels.begin());
+            order.resize(n_);
+            std::vector<int> fill(levels.cbegin(), levels.cend() - 1);
+            for(int i = 0; i < n_; ++i)
+                order[fill[level[i]]++] = i;
+        }
+        /* Function: analyze
+         *  Computes the level-of-fill pattern of the factors and the level schedules of the triangular solves. */
+        template<char N>
+        void analyze(const MatrixCSR<K>* const A) {
+            std::vector<int> pia(n_ + 1), pja;
+            for(int i = 0; i < n_; ++i) {
+                ++pia[i + 1];
+                for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                    ++pia[i + 1];
+                    if(sym_)
+                        ++pia[A->ja_[j] - (N == 'F') + 1];
+                }
+            }
+            std::partial_sum(pia.cbegin(), pia.cend(), pia.begin());
+            pja.resize(pia[n_]);
+            {
+                std::vector<int> fill(pia.cbegin(), pia.cend() - 1), mark(n_, -1);
+                for(int i = 0; i < n_; ++i) {
+                    pja[fill[i]++] = i;
+                    for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                        const int col = A->ja_[j] - (N == 'F');
+                        pja[fill[i]++] = col;
+                        if(sym_)
+                            pja[fill[col]++] = i;
+                    }
+                }
+                int nnz = 0;
+                for(int i = 0; i < n_; ++i) {
+                    const int start = nnz;
+                    for(int p = pia[i]; p < pia[i + 1]; ++p)
+                        if(mark[pja[p]] != i) {
+                            mark[pja[p]] = i;
+                            pja[nnz++] = pja[p];
+                        }
+                    std::sort(pja.begin() + start, pja.begin() + nnz);
+                    pia[i] = start;
+                }
+                pia[n_] = nnz;
+            }
+            std::vector<int> uia(1, 0), uja, ulev, lev(n_), next(n_ + 1);
+            ia_.assign(1, 0);
+            ja_.clear();
+            diag_.resize(n_);
+            for(int i = 0; i < n_; ++i) {
+                int head = n_;
+                for(int p = pia[i + 1] - 1; p >= pia[i]; --p) {
+                    next[pja[p]] = head;
+                    head = pja[p];
+                    lev[pja[p]] = 0;
+                }
+                if(fill_ > 0)
+                    for(int k = head; k < i; k = next[k])
+                        for(int q = uia[k], prev = k; q < uia[k + 1]; ++q) {
+                            const int l = lev[k] + ulev[q] + 1;
+                            if(l > fill_)
+                                continue;
+                            const int j = uja[q];
+                            while(next[prev] < j)
+                                prev = next[prev];
+                            if(next[prev] != j) {
+                                next[j] = next[prev];
+                                next[prev] = j;
+                                lev[j] = l;
+                            }
+                            else
+                                lev[j] = std::min(lev[j], l);
+                            prev = j;
+                        }
+                for(int j = head; j < n_; j = next[j]) {
+                    if(j == i)
+                        diag_[i] = ja_.size();
+                    if(!sym_ || j <= i)
+                        ja_.emplace_back(j);
+                    if(j > i) {
+                        uja.emplace_back(j);
+                        ulev.emplace_back(lev[j]);
+                    }
+                }
+                ia_.emplace_back(ja_.size());
+                uia.emplace_back(uja.size());
+            }
+            a_.resize(ja_.size());
+            map_.resize(nnz_);
+            for(int i = 0; i < n_; ++i)
+                for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                    int r = i, c = A->ja_[j] - (N == 'F');
+                    if(sym_ && c > r)
+                        std::swap(r, c);
+                    map_[j] = std::distance(ja_.data(), std::lower_bound(ja_.data() + ia_[r], ja_.data() + ia_[r + 1], c));
+                }
+            schedule(forward_, flevels_, false, [&](int i, const std::function<void(int)>& f) { for(int p = ia_[i]; p < diag_[i]; ++p) f(ja_[p]); });
+            if(sym_) {
+                tia_.assign(n_ + 1, 0);
+                for(int i = 0; i < n_; ++i)
+                    for(int p = ia_[i]; p < diag_[i]; ++p)
+                        ++tia_[ja_[p] + 1];
+                std::partial_sum(tia_.cbegin(), tia_.cend(), tia_.begin());
+                tja_.resize(tia_[n_]);
+                tpos_.resize(tia_[n_]);
+                std::vector<int> fill(tia_.cbegin(), tia_.cend() - 1);
+                for(int i = 0; i < n_; ++i)
+                    for(int p = ia_[i]; p < diag_[i]; ++p) {
+                        tja_[fill[ja_[p]]] = i;
+                        tpos_[fill[ja_[p]]++] = p;
+                    }
+                schedule(backward_, blevels_, true, [&](int i, const std::function<void(int)>& f) { for(int p = tia_[i]; p < tia_[i + 1]; ++p) f(tja_[p]); });
+            }
+            else
+                schedule(backward_, blevels_, true, [&](int i, const std::function<void(int)>& f) { for(int p = diag_[i] + 1; p < ia_[i + 1]; ++p) f(ja_[p]); });
+        }
+        /* Function: pivot
+         *  Replaces a vanishing pivot by the magnitude of the original diagonal entry, and counts such replacements in <IluSub::replaced>. */
+        K pivot(const K& d, const K& original) {
+            if(std::abs(d) > HPDDM_EPS * std::abs(original))
+                return d;
+            ++replaced_;
+            return std::abs(original) > 0.0 ? K(std::abs(original)) : K(1.0);
+        }
+    public:
+        IluSub() : hash_(), n_(), nnz_(), fill_(-1), replaced_(), sym_(), conj_() { }
+        IluSub(const IluSub&) = delete;
+        ~IluSub() { dtor(); }
+        static constexpr char numbering_ = 'C';
+        void dtor() {
+            std::vector<K>().swap(a_);
+            std::vector<int>().swap(map_);
+            n_ = nnz_ = 0;
+        }
+        /* Function: numfact
+         *
+         *  Computes an incomplete factorization of a local matrix. The pattern of the factors is only computed when the pattern of the matrix or the level of fill changes.
+         *
+         * Template Parameter:
+         *    N              - 0- or 1-based indexing of the input matrix.
+         *
+         * Parameter:
+         *    A              - Matrix to factorize. */
+        template<char N = HPDDM_NUMBERING>
+        void numfact(MatrixCSR<K>* const& A, bool detection = false, K* const& = nullptr) {
+            static_assert(N == 'C' || N == 'F', "Unknown numbering");
+            const int fill = Option::get()->val<int>("ilu_fill_level", 0);
+            const std::size_t hash = A->hashIndices();
+            if(A->n_ != n_ || A->nnz_ != nnz_ || A->sym_ != sym_ || hash != hash_ || fill != fill_ || map_.empty()) {
+                n_ = A->n_;
+                nnz_ = A->nnz_;
+                sym_ = A->sym_;
+                hash_ = hash;
+                fill_ = fill;
+                analyze<N>(A);
+            }
+            conj_ = sym_ && Wrapper<K>::is_complex && Option::get()->val<char>("operator_spd", 0) && !detection;
+            std::fill(a_.begin(), a_.end(), K());
+            for(int i = 0; i < n_; ++i)
+                for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j)
+                    a_[map_[j]] += (conj_ && A->ja_[j] - (N == 'F') > i ? Wrapper<K>::conj(A->a_[j]) : A->a_[j]);
+            std::vector<int> pos(n_, -1);
+            replaced_ = 0;
+            for(int i = 0; i < n_; ++i) {
+                for(int p = ia_[i]; p < ia_[i + 1]; ++p)
+                    pos[ja_[p]] = p;
+                const K original = a_[diag_[i]];
+                if(!sym_) {
+                    for(int p = ia_[i]; p < diag_[i]; ++p) {
+                        const int k = ja_[p];
+                        a_[p] /= a_[diag_[k]];
+                        for(int q = diag_[k] + 1; q < ia_[k + 1]; ++q)
+                            if(pos[ja_[q]] != -1)
+                                a_[pos[ja_[q]]] -= a_[p] * a_[q];
+                    }
+                }
+                else {
+                    K d = a_[diag_[i]];
+                    for(int p = ia_[i]; p < diag_[i]; ++p) {
+                        const int k = ja_[p];
+                        K s = a_[p];
+                        for(int q = ia_[k]; q < diag_[k]; ++q)
+                            if(pos[ja_[q]] != -1)
+                                s -= a_[pos[ja_[q]]] * a_[diag_[ja_[q]]] * (conj_ ? Wrapper<K>::conj(a_[q]) : a_[q]);
+                        a_[p] = s / a_[diag_[k]];
+                        d -= a_[p] * a_[diag_[k]] * (conj_ ? Wrapper<K>::conj(a_[p]) : a_[p]);
+                    }
+                    a_[diag_[i]] = d;
+                }
+                a_[diag_[i]] = pivot(a_[diag_[i]], original);
+                for(int p = ia_[i]; p < ia_[i + 1]; ++p)
+                    pos[ja_[p]] = -1;
+            }
+            if(replaced_ && Option::get()->val<char>("verbosity", 0))
+                std::cout << "WARNING -- " << replaced_ << " vanishing pivot" << (replaced_ > 1 ? "s" : "") << " replaced in the incomplete factorization of a local matrix of size " << n_ << std::endl;
+        }
+        template<char N = HPDDM_NUMBERING>
+        int inertia(MatrixCSR<K>* const&) { return 0; }
+        unsigned short deficiency() const { return 0; }
+        void solve(K* const x, const unsigned short& n = 1) const {
+            for(int l = 0; l < static_cast<int>(flevels_.size()) - 1; ++l) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if((flevels_[l + 1] - flevels_[l]) * n > HPDDM_GRANULARITY)
+#endif
+                for(int r = flevels_[l]; r < flevels_[l + 1]; ++r) {
+                    const int i = forward_[r];
+                    for(unsigned short nu = 0; nu < n; ++nu) {
+                        K* const y = x + nu * n_;
+                        K s = y[i];
+                        for(int p = ia_[i]; p < diag_[i]; ++p)
+                            s -= a_[p] * y[ja_[p]];
+                        y[i] = s;
+                    }
+                }
+            }
+            for(int l = 0; l < static_cast<int>(blevels_.size()) - 1; ++l) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if((blevels_[l + 1] - blevels_[l]) * n > HPDDM_GRANULARITY)
+#endif
+                for(int r = blevels_[l]; r < blevels_[l + 1]; ++r) {
+                    const int i = backward_[r];
+                    for(unsigned short nu = 0; nu < n; ++nu) {
+                        K* const y = x + nu * n_;
+                        if(sym_) {
+                            K s = y[i] / a_[diag_[i]];
+                            for(int p = tia_[i]; p < tia_[i + 1]; ++p)
+                                s -= (conj_ ? Wrapper<K>::conj(a_[tpos_[p]]) : a_[tpos_[p]]) * y[tja_[p]];
+                            y[i] = s;
+                        }
+                        else {
+                            K s = y[i];
+                            for(int p = diag_[i] + 1; p < ia_[i + 1]; ++p)
+                                s -= a_[p] * y[ja_[p]];
+                            y[i] = s / a_[diag_[i]];
+                        }
+                    }
+                }
+            }
+        }
+        void solve(const K* const b, K* const x, const unsigned short& n = 1) const {
+            std::copy_n(b, n * n_, x);
+            solve(x, n);
+        }
+};
+} // HPDDM
+#endif // HPDDM_ILU_HPP_
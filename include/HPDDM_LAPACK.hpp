@@ -364,6 +364,7 @@ class LapackTRSub {
         }
         template<char N = HPDDM_NUMBERING, bool transpose = false>
         void numfact(MatrixCSR<K>* const& A, bool detection = false, K* const& = nullptr) {
+            dtor();
             n_ = A->n_;
             a_ = new K[n_ * n_]();
             if(A->nnz_ == n_ * n_) {
@@ -408,6 +409,9 @@ class LapackTRSub {
         template<char N = HPDDM_NUMBERING>
         int inertia(MatrixCSR<K>* const&) { return 0; }
         unsigned short deficiency() const { return 0; }
+        /* Function: nnz
+         *  Returns the number of entries of the factors. */
+        std::size_t nnz() const { return type_ ? (static_cast<std::size_t>(n_) * (n_ + 1)) / 2 : static_cast<std::size_t>(n_) * n_; }
         void solve(K* const x, const unsigned short& n = 1) const {
             int nrhs = n, info;
             if(type_ == 1)
@@ -0,0 +1,251 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPDDM_LOBPCG_HPP_
+#define HPDDM_LOBPCG_HPP_
+
+#include "HPDDM_eigensolver.hpp"
+
+namespace HPDDM {
+#ifdef MU_LOBPCG
+#undef HPDDM_CHECK_COARSEOPERATOR
+#undef HPDDM_CHECK_SUBDOMAIN
+#define HPDDM_CHECK_EIGENSOLVER
+#include "HPDDM_preprocessor_check.hpp"
+#define EIGENSOLVER HPDDM::Lobpcg
+#endif
+/* Class: Lobpcg
+ *
+ *  A class inheriting from <Eigensolver> to use the Locally Optimal Block Preconditioned Conjugate Gradient method for sparse eigenvalue problems.
+ *  The smallest eigenvalues of Ax = l Bx are computed as the largest eigenvalues of Bx = m (A + B)x, with m = 1 / (1 + l), so that both A and B may be singular. The factorization of A is used as preconditioner, and all operations are performed on blocks of vectors.
+ *
+ * Template Parameter:
+ *    K              - Scalar type. */
+template<class K>
+class Lobpcg : public Eigensolver<K> {
+    private:
+        /* Variable: it
+         *  Maximum number of iterations. */
+        unsigned short                        it_;
+        /* Function: orthonormalize
+         *  Makes a block of vectors orthonormal with respect to the inner product induced by A + B, using a Cholesky QR factorization. Returns false if the block is numerically rank deficient. */
+        bool orthonormalize(int mu, K* const V, K* const MV, K* const BV, K* const G) const {
+            const int* const n = &(Eigensolver<K>::n_);
+            int info;
+            Blas<K>::gemm(&(Wrapper<K>::transc), "N", &mu, &mu, n, &(Wrapper<K>::d__1), V, n, MV, n, &(Wrapper<K>::d__0), G, &mu);
+            Lapack<K>::potrf("U", &mu, G, &mu, &info);
+            if(info)
+                return false;
+            for(K* const v : { V, MV, BV })
+                if(v)
+                    Blas<K>::trsm("R", "U", "N", "N", n, &mu, &(Wrapper<K>::d__1), G, &mu, v, n);
+            return true;
+        }
+        /* Function: project
+         *  Removes from a block of vectors its components along an (A + B)-orthonormal block. */
+        void project(int mu, K* const V, K* const MV, K* const BV, int k, const K* const Q, const K* const MQ, const K* const BQ, K* const G) const {
+            const int* const n = &(Eigensolver<K>::n_);
+            Blas<K>::gemm(&(Wrapper<K>::transc), "N", &k, &mu, n, &(Wrapper<K>::d__1), Q, n, MV, n, &(Wrapper<K>::d__0), G, &k);
+            Blas<K>::gemm("N", "N", n, &mu, &k, &(Wrapper<K>::d__2), Q, n, G, &k, &(Wrapper<K>::d__1), V, n);
+            Blas<K>::gemm("N", "N", n, &mu, &k, &(Wrapper<K>::d__2), MQ, n, G, &k, &(Wrapper<K>::d__1), MV, n);
+            Blas<K>::gemm("N", "N", n, &mu, &k, &(Wrapper<K>::d__2), BQ, n, G, &k, &(Wrapper<K>::d__1), BV, n);
+        }
+    public:
+        Lobpcg(int n, int nu)                                                                          : Eigensolver<K>(n, nu), it_(Option::get()->val<unsigned short>("lobpcg_max_it", 100)) { }
+        Lobpcg(underlying_type<K> threshold, int n, int nu)                                            : Eigensolver<K>(threshold, n, nu), it_(Option::get()->val<unsigned short>("lobpcg_max_it", 100)) { }
+        Lobpcg(underlying_type<K> tol, underlying_type<K> threshold, int n, int nu, unsigned short it) : Eigensolver<K>(tol, threshold, n, nu), it_(it) { }
+        /* Function: solve
+         *
+         *  Computes eigenvectors of the generalized eigenvalue problem Ax = l Bx.
+         *
+         * Parameters:
+         *    A              - Left-hand side matrix.
+         *    B              - Right-hand side matrix.
+         *    ev             - Array of eigenvectors.
+         *    communicator   - MPI communicator for selecting the threshold criterion. */
+        template<template<class> class Solver>
+        void solve(MatrixCSR<K>* const& A, MatrixCSR<K>* const& B, K**& ev, const MPI_Comm& communicator, Solver<K>* const& s = nullptr, std::ios_base::openmode mode = std::ios_base::out) {
+            const int n = Eigensolver<K>::n_;
+            if(4 * Eigensolver<K>::nu_ > n)
+                Eigensolver<K>::nu_ = std::max(1, n / 4);
+            int nu = Eigensolver<K>::nu_;
+            K* evr = nullptr;
+            unsigned short it = 0;
+            std::vector<underlying_type<K>> mu, norm;
+            int m = 0;
+            Solver<K>* prec = nullptr;
+            std::size_t block = 0;
+            std::vector<K> storage;
+            K* S = nullptr;
+            K* MS = nullptr;
+            K* BS = nullptr;
+            K* T = nullptr;
+            K* H = nullptr;
+            if(nu) {
+                m = std::max(nu, std::min(n / 3, nu + std::max(2, nu / 4)));
+                prec = s ? s : new Solver<K>;
+#ifdef MUMPSSUB
+                prec->numfact(A, false);
+#else
+                prec->numfact(A, true);
+#endif
+                /* a rank-deficient initial block is first drawn again without the warm start vectors, and then halved, and no eigenpair is computed if a single vector cannot be normalized */
+                for(unsigned short attempt = 0; ; ++attempt) {
+                    block = static_cast<std::size_t>(n) * m;
+                    storage.assign(11 * block + 18 * m * m, K());
+                    S = storage.data();
+                    MS = S + 3 * block;
+                    BS = MS + 3 * block;
+                    T = BS + 3 * block;
+                    H = T + 2 * block;
+                    std::default_random_engine generator(attempt);
+                    std::uniform_real_distribution<underlying_type<K>> uniform(-1.0, 1.0);
+                    std::for_each(S, S + block, [&](K& v) { v = uniform(generator); });
+                    if(!attempt)
+                        for(int i = 0; i < std::min(Eigensolver<K>::k_, m); ++i)
+                            if(Eigensolver<K>::x_[i])
+                                std::copy_n(Eigensolver<K>::x_[i], n, S + i * n);
+                    Eigensolver<K>::apply(A, B, S, MS, BS, m);
+                    if(orthonormalize(m, S, MS, BS, H))
+                        break;
+                    if(attempt && m == 1) {
+                        m = 0;
+                        break;
+                    }
+                    if(attempt)
+                        m /= 2;
+                }
+                if(m < nu) {
+                    nu = Eigensolver<K>::nu_ = m;
+                    if(Option::get()->val<char>("verbosity", 0) > 0)
+                        std::cout << "WARNING -- the initial LOBPCG block is rank deficient, now computing " << nu << " eigenpair" << (nu != 1 ? "s" : "") << std::endl;
+                    if(!nu && !s)
+                        delete prec;
+                }
+            }
+            if(nu) {
+                K* const Z = H + 9 * m * m;
+                mu.resize(3 * m);
+                norm.resize(m);
+                std::vector<int> active(m);
+                const underlying_type<K> tol = std::max(Eigensolver<K>::tol_, std::sqrt(std::numeric_limits<underlying_type<K>>::epsilon()));
+                int a = 0, p = 0, converged = 0;
+                for(int size = m; ; ++it) {
+                    /* Rayleigh--Ritz procedure on the (A + B)-orthonormal basis [X W P] */
+                    Blas<K>::gemm(&(Wrapper<K>::transc), "N", &size, &size, &n, &(Wrapper<K>::d__1), S, &n, BS, &n, &(Wrapper<K>::d__0), H, &size);
+                    Eigensolver<K>::rayleighRitz(size, H, mu.data(), Z);
+                    std::reverse(mu.begin(), mu.begin() + size);
+                    for(int j = 0; j < m; ++j)
+                        std::copy_n(Z + (size - 1 - j) * size, size, H + j * size);
+                    for(K* const v : { S, MS, BS }) {
+                        if(size > m) {
+                            const int q = size - m;
+                            Blas<K>::gemm("N", "N", &n, &m, &q, &(Wrapper<K>::d__1), v + block, &n, H + m, &size, &(Wrapper<K>::d__0), T + block, &n);
+                            std::copy_n(T + block, block, T);
+                        }
+                        Blas<K>::gemm("N", "N", &n, &m, &m, &(Wrapper<K>::d__1), v, &n, H, &size, size > m ? &(Wrapper<K>::d__1) : &(Wrapper<K>::d__0), T, &n);
+                        std::copy_n(T, block, v);
+                        if(size > m)
+                            std::copy_n(T + block, block, v + 2 * block);
+                    }
+                    /* residuals R = BX - (A + B)X diag(mu), only nonconverged columns are kept */
+                    K* const W = S + block;
+                    K* const MW = MS + block;
+                    K* const BW = BS + block;
+                    std::copy_n(BS, block, W);
+                    converged = 0;
+                    a = 0;
+                    for(int j = 0; j < m; ++j) {
+                        const K lambda = -mu[j];
+                        Blas<K>::axpy(&n, &lambda, MS + j * n, &i__1, W + j * n, &i__1);
+                        const underlying_type<K> scale = Blas<K>::nrm2(&n, BS + j * n, &i__1) + std::abs(mu[j]) * Blas<K>::nrm2(&n, MS + j * n, &i__1);
+                        norm[j] = Blas<K>::nrm2(&n, W + j * n, &i__1) / (scale > 0.0 ? scale : 1.0);
+                        if(norm[j] <= tol)
+                            converged += (j < nu);
+                        else
+                            active[a++] = j;
+                    }
+                    if(converged == nu || it == it_)
+                        break;
+                    p = (size > m ? a : 0);
+                    for(int k = 0; k < a; ++k) {
+                        if(active[k] != k)
+                            std::copy_n(W + active[k] * n, n, W + k * n);
+                        if(p && (a != m || active[k] != k))
+                            for(K* const v : { S, MS, BS })
+                                std::copy_n(v + 2 * block + active[k] * n, n, v + block + (a + k) * n);
+                    }
+                    K* const P = W + a * n;
+                    K* const MP = MW + a * n;
+                    K* const BP = BW + a * n;
+                    /* P is made (A + B)-orthonormal and (A + B)-orthogonal to X */
+                    if(p) {
+                        project(p, P, MP, BP, m, S, MS, BS, H);
+                        if(!orthonormalize(p, P, MP, BP, H))
+                            p = 0;
+                    }
+                    /* W = A^-1 R, made (A + B)-orthonormal and (A + B)-orthogonal to X and P, twice for stability */
+                    prec->solve(W, a);
+                    Eigensolver<K>::apply(A, B, W, MW, BW, a);
+                    bool valid = true;
+                    for(unsigned short i = 0; i < 2 && valid; ++i) {
+                        project(a, W, MW, BW, m, S, MS, BS, H);
+                        if(p)
+                            project(a, W, MW, BW, p, P, MP, BP, H);
+                        valid = orthonormalize(a, W, MW, BW, H);
+                    }
+                    if(!valid)
+                        break;
+                    size = m + a + p;
+                }
+                if(!s)
+                    delete prec;
+                if(converged < nu && Option::get()->val<char>("verbosity", 0) > 0)
+                    std::cout << "WARNING -- LOBPCG does not converge after " << it << " iteration" << (it > 1 ? "s" : "") << ", " << converged << " eigenpair" << (converged != 1 ? "s" : "") << " out of " << nu << " converged" << std::endl;
+                evr = new K[nu];
+                ev = new K*[nu];
+                *ev = new K[n * nu];
+                for(int i = 0; i < nu; ++i) {
+                    ev[i] = *ev + i * n;
+                    evr[i] = mu[i] > HPDDM_EPS ? 1.0 / mu[i] - 1.0 : 1.0 / HPDDM_EPS;
+                }
+                std::copy_n(S, n * nu, *ev);
+                std::string name = Eigensolver<K>::dump(evr, ev, communicator, mode);
+                if(!name.empty()) {
+                    std::ofstream output(name, std::fstream::in | std::fstream::out | std::fstream::app);
+                    output << "LOBPCG information:\n";
+                    output << "\t" << it << " iteration" << (it > 1 ? "s" : "") << "\n";
+                    output << "\t" << *std::max_element(norm.cbegin(), norm.cbegin() + nu) << " maximum relative residual\n";
+                    output << "\n\n";
+                }
+            }
+            else {
+                ev = new K*[1];
+                *ev = nullptr;
+            }
+            if(Eigensolver<K>::threshold_ > 0.0)
+                Eigensolver<K>::selectNu(evr, ev, communicator);
+            delete [] evr;
+        }
+};
+} // HPDDM
+#endif // HPDDM_LOBPCG_HPP_
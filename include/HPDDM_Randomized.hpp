@@ -0,0 +1,160 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPDDM_RANDOMIZED_HPP_
+#define HPDDM_RANDOMIZED_HPP_
+
+#include "HPDDM_eigensolver.hpp"
+
+namespace HPDDM {
+#ifdef MU_RANDOMIZED
+#undef HPDDM_CHECK_COARSEOPERATOR
+#undef HPDDM_CHECK_SUBDOMAIN
+#define HPDDM_CHECK_EIGENSOLVER
+#include "HPDDM_preprocessor_check.hpp"
+#define EIGENSOLVER HPDDM::Randomized
+#endif
+/* Class: Randomized
+ *
+ *  A class inheriting from <Eigensolver> to compute approximate eigenpairs by randomized subspace iteration.
+ *  A Gaussian block, or an initial block completed with Gaussian vectors, is multiplied a few times by the inverse of A times B, and the smallest eigenvalues of Ax = l Bx are then approximated by a Rayleigh--Ritz procedure on the resulting subspace, so that only multiple right-hand side solves with the factorization of A are needed.
+ *
+ * Template Parameter:
+ *    K              - Scalar type. */
+template<class K>
+class Randomized : public Eigensolver<K> {
+    private:
+        /* Variable: p
+         *  Number of additional random vectors. */
+        unsigned short                         p_;
+        /* Variable: q
+         *  Number of power iterations. */
+        unsigned short                         q_;
+        /* Function: orthonormalize
+         *  Makes a block of vectors orthonormal with respect to the inner product induced by A + B, using the eigendecomposition of its Gram matrix so that numerically dependent vectors are discarded. Returns the number of remaining vectors. */
+        int orthonormalize(int k, K* const V, K* const MV, K* const BV, K* const G, K* const Z, K* const T) const {
+            const int n = Eigensolver<K>::n_;
+            Blas<K>::gemm(&(Wrapper<K>::transc), "N", &k, &k, &n, &(Wrapper<K>::d__1), V, &n, MV, &n, &(Wrapper<K>::d__0), G, &k);
+            std::vector<underlying_type<K>> s(k);
+            Eigensolver<K>::rayleighRitz(k, G, s.data(), Z);
+            int r = 0;
+            while(r < k && s[k - 1 - r] > k * std::numeric_limits<underlying_type<K>>::epsilon() * s[k - 1]) {
+                const underlying_type<K> scaling = 1.0 / std::sqrt(s[k - 1 - r]);
+                std::transform(Z + (k - 1 - r) * k, Z + (k - r) * k, G + r * k, [&](const K& z) { return scaling * z; });
+                ++r;
+            }
+            if(r)
+                for(K* const v : { V, MV, BV }) {
+                    Blas<K>::gemm("N", "N", &n, &r, &k, &(Wrapper<K>::d__1), v, &n, G, &k, &(Wrapper<K>::d__0), T, &n);
+                    std::copy_n(T, n * r, v);
+                }
+            return r;
+        }
+    public:
+        Randomized(int n, int nu)                                                                          : Eigensolver<K>(n, nu), p_(Option::get()->val<unsigned short>("randomized_oversampling", 10)), q_(Option::get()->val<unsigned short>("randomized_power_it", 2)) { }
+        Randomized(underlying_type<K> threshold, int n, int nu)                                            : Eigensolver<K>(threshold, n, nu), p_(Option::get()->val<unsigned short>("randomized_oversampling", 10)), q_(Option::get()->val<unsigned short>("randomized_power_it", 2)) { }
+        Randomized(underlying_type<K> tol, underlying_type<K> threshold, int n, int nu, unsigned short it) : Eigensolver<K>(tol, threshold, n, nu), p_(Option::get()->val<unsigned short>("randomized_oversampling", 10)), q_(it) { }
+        /* Function: solve
+         *
+         *  Computes approximate eigenvectors of the generalized eigenvalue problem Ax = l Bx.
+         *
+         * Parameters:
+         *    A              - Left-hand side matrix.
+         *    B              - Right-hand side matrix.
+         *    ev             - Array of eigenvectors.
+         *    communicator   - MPI communicator for selecting the threshold criterion. */
+        template<template<class> class Solver>
+        void solve(MatrixCSR<K>* const& A, MatrixCSR<K>* const& B, K**& ev, const MPI_Comm& communicator, Solver<K>* const& s = nullptr, std::ios_base::openmode mode = std::ios_base::out) {
+            const int n = Eigensolver<K>::n_;
+            if(4 * Eigensolver<K>::nu_ > n)
+                Eigensolver<K>::nu_ = std::max(1, n / 4);
+            K* evr = nullptr;
+            if(Eigensolver<K>::nu_) {
+                int k = std::min(n, Eigensolver<K>::nu_ + p_);
+                Solver<K>* const prec = s ? s : new Solver<K>;
+#ifdef MUMPSSUB
+                prec->numfact(A, false);
+#else
+                prec->numfact(A, true);
+#endif
+                const std::size_t block = static_cast<std::size_t>(n) * k;
+                std::vector<K> storage(4 * block + 2 * k * k);
+                K* const Y = storage.data();
+                K* const MY = Y + block;
+                K* const BY = MY + block;
+                K* const T = BY + block;
+                K* const G = T + block;
+                K* const Z = G + k * k;
+                {
+                    std::default_random_engine generator;
+                    std::normal_distribution<underlying_type<K>> gaussian;
+                    std::for_each(Y, Y + block, [&](K& v) { v = gaussian(generator); });
+                    for(int i = 0; i < std::min(Eigensolver<K>::k_, k); ++i)
+                        if(Eigensolver<K>::x_[i])
+                            std::copy_n(Eigensolver<K>::x_[i], n, Y + i * n);
+                }
+                Eigensolver<K>::apply(B, Y, BY, k);
+                for(unsigned short i = 0; i <= q_ && k; ++i) {
+                    std::copy_n(BY, n * k, Y);
+                    prec->solve(Y, k);
+                    Eigensolver<K>::apply(A, B, Y, MY, BY, k);
+                    k = orthonormalize(k, Y, MY, BY, G, Z, T);
+                }
+                if(!s)
+                    delete prec;
+                Eigensolver<K>::nu_ = std::min(Eigensolver<K>::nu_, k);
+                if(Eigensolver<K>::nu_) {
+                    const int nu = Eigensolver<K>::nu_;
+                    std::vector<underlying_type<K>> mu(k);
+                    Blas<K>::gemm(&(Wrapper<K>::transc), "N", &k, &k, &n, &(Wrapper<K>::d__1), Y, &n, BY, &n, &(Wrapper<K>::d__0), G, &k);
+                    Eigensolver<K>::rayleighRitz(k, G, mu.data(), Z);
+                    for(int j = 0; j < nu; ++j)
+                        std::copy_n(Z + (k - 1 - j) * k, k, G + j * k);
+                    evr = new K[nu];
+                    ev = new K*[nu];
+                    *ev = new K[n * nu];
+                    for(int i = 0; i < nu; ++i) {
+                        ev[i] = *ev + i * n;
+                        evr[i] = mu[k - 1 - i] > HPDDM_EPS ? 1.0 / mu[k - 1 - i] - 1.0 : 1.0 / HPDDM_EPS;
+                    }
+                    Blas<K>::gemm("N", "N", &n, &nu, &k, &(Wrapper<K>::d__1), Y, &n, G, &k, &(Wrapper<K>::d__0), *ev, &n);
+                    std::string name = Eigensolver<K>::dump(evr, ev, communicator, mode);
+                    if(!name.empty()) {
+                        std::ofstream output(name, std::fstream::in | std::fstream::out | std::fstream::app);
+                        output << "Randomized subspace iteration information:\n";
+                        output << "\t" << k << " basis vector" << (k > 1 ? "s" : "") << "\n";
+                        output << "\t" << q_ << " power iteration" << (q_ > 1 ? "s" : "") << "\n";
+                        output << "\n\n";
+                    }
+                }
+            }
+            if(!Eigensolver<K>::nu_) {
+                ev = new K*[1];
+                *ev = nullptr;
+            }
+            if(Eigensolver<K>::threshold_ > 0.0)
+                Eigensolver<K>::selectNu(evr, ev, communicator);
+            delete [] evr;
+        }
+};
+} // HPDDM
+#endif // HPDDM_RANDOMIZED_HPP_
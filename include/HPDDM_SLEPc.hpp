@@ -78,6 +78,18 @@ class Slepc : public Eigensolver<K> {
                 PetscCall(EPSSetOptionsPrefix(eps, std::string("slepc_" + std::string(HPDDM_PREFIX) + opt.getPrefix()).c_str()));
                 PetscCall(EPSSetDimensions(eps, Eigensolver<K>::nu_, PETSC_DEFAULT, PETSC_DEFAULT));
                 PetscCall(EPSSetFromOptions(eps));
+                if(Eigensolver<K>::k_) {
+                    std::vector<Vec> is;
+                    is.reserve(Eigensolver<K>::k_);
+                    for(int i = 0; i < Eigensolver<K>::k_; ++i)
+                        if(Eigensolver<K>::x_[i]) {
+                            is.emplace_back();
+                            PetscCall(VecCreateSeqWithArray(PETSC_COMM_SELF, 1, Eigensolver<K>::n_, Eigensolver<K>::x_[i], &is.back()));
+                        }
+                    PetscCall(EPSSetInitialSpace(eps, is.size(), is.data()));
+                    for(Vec& v : is)
+                        PetscCall(VecDestroy(&v));
+                }
                 PetscCall(EPSSolve(eps));
                 PetscCall(EPSGetConverged(eps, &nconv));
                 Eigensolver<K>::nu_ = std::min(static_cast<int>(nconv), Eigensolver<K>::nu_);
@@ -0,0 +1,618 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPDDM_SUPERNODAL_HPP_
+#define HPDDM_SUPERNODAL_HPP_
+
+#include "HPDDM_LAPACK.hpp"
+
+#ifdef SUPERNODALSUB
+#undef HPDDM_CHECK_COARSEOPERATOR
+#define HPDDM_CHECK_SUBDOMAIN
+#include "HPDDM_preprocessor_check.hpp"
+#define SUBDOMAIN HPDDM::SupernodalSub
+#endif
+
+namespace HPDDM {
+/* Class: Supernodal Sub
+ *
+ *  A class for factorizing and solving sparse local systems without any external direct solver.
+ *  The unknowns are reordered by nested dissection, the structure of the factor is computed once per sparsity pattern, and the numerical factorization is left-looking with dense supernodal panels updated by level-3 BLAS.
+ *  Symmetric matrices are factorized as LL<sup>H</sup> when <Option> operator_spd is set, and as LDL<sup>T</sup> otherwise. If the LL<sup>H</sup> factorization breaks down because the matrix is not positive definite, it is factorized again as LDL<sup>H</sup>. Unsymmetric matrices are factorized as LU on the symmetrized pattern, with pivoting restricted to the diagonal blocks of supernodes.
+ *
+ * Template Parameter:
+ *    K              - Scalar type. */
+template<class K>
+class SupernodalSub {
+    private:
+        /* Variable: values
+         *  Numerical values of the panels, <Supernodal Sub::uptr> is only used for unsymmetric matrices. */
+        std::vector<K>           values_;
+        /* Variable: work
+         *  Workspace used by <Supernodal Sub::solve>. */
+        mutable std::vector<K>     work_;
+        /* Variable: perm
+         *  Fill-reducing permutation, new to old. */
+        std::vector<int>           perm_;
+        /* Variable: iperm
+         *  Inverse of <Supernodal Sub::perm>. */
+        std::vector<int>          iperm_;
+        /* Variable: super
+         *  First column of each supernode. */
+        std::vector<int>          super_;
+        /* Variable: snode
+         *  Supernode of each column. */
+        std::vector<int>          snode_;
+        /* Variable: rowptr
+         *  Offsets of the row structures of each supernode in <Supernodal Sub::rows>. */
+        std::vector<int>         rowptr_;
+        /* Variable: rows
+         *  Row structures, the columns of a supernode first and then its off-diagonal rows in increasing order. */
+        std::vector<int>           rows_;
+        /* Variable: ipiv
+         *  Local pivots of the diagonal blocks of unsymmetric matrices. */
+        std::vector<int>           ipiv_;
+        /* Variable: lptr
+         *  Offsets of the column-major lower panels in <Supernodal Sub::values>. */
+        std::vector<std::size_t>   lptr_;
+        /* Variable: uptr
+         *  Offsets of the transposed upper panels in <Supernodal Sub::values>. */
+        std::vector<std::size_t>   uptr_;
+        /* Variable: dest
+         *  Position of each nonzero of the input matrix in <Supernodal Sub::values>. */
+        std::vector<std::size_t>   dest_;
+        /* Variable: hash
+         *  Hash of the pattern of the last analyzed matrix. */
+        std::size_t                hash_;
+        int                           n_;
+        int                         nnz_;
+        int                     maxSize_;
+        unsigned short       deficiency_;
+        /* Variable: type
+         *  0 for LU, 1 for LDL<sup>T</sup>, 2 for LL<sup>H</sup>, 3 for LDL<sup>H</sup>. */
+        unsigned short             type_;
+        bool                        sym_;
+        /* Function: order
+         *  Computes <Supernodal Sub::perm> by recursive bisection of level structures. */
+        void order(const std::vector<int>& xadj, const std::vector<int>& adj) {
+            perm_.resize(n_);
+            std::iota(perm_.begin(), perm_.end(), 0);
+            std::vector<int> stamp(n_, -1), level(n_, -1), queue(n_), tmp(n_);
+            std::vector<std::pair<int, int>> stack(1, std::make_pair(0, n_));
+            int id = 0;
+            auto bfs = [&](int root, int lo, int hi, int& count) {
+                for(int i = lo; i < hi; ++i)
+                    level[perm_[i]] = -1;
+                level[root] = 0;
+                queue[0] = root;
+                count = 1;
+                for(int i = 0; i < count; ++i) {
+                    const int v = queue[i];
+                    for(int p = xadj[v]; p < xadj[v + 1]; ++p)
+                        if(stamp[adj[p]] == id && level[adj[p]] == -1) {
+                            level[adj[p]] = level[v] + 1;
+                            queue[count++] = adj[p];
+                        }
+                }
+                return level[queue[count - 1]] + 1;
+            };
+            while(!stack.empty()) {
+                const int lo = stack.back().first, hi = stack.back().second;
+                stack.pop_back();
+                if(hi - lo <= HPDDM_SUPERNODAL_LEAF)
+                    continue;
+                ++id;
+                for(int i = lo; i < hi; ++i)
+                    stamp[perm_[i]] = id;
+                int count, root = perm_[lo];
+                int depth = bfs(root, lo, hi, count);
+                if(count < hi - lo) {
+                    int* const middle = std::stable_partition(perm_.data() + lo, perm_.data() + hi, [&](int v) { return level[v] != -1; });
+                    stack.emplace_back(lo, std::distance(perm_.data(), middle));
+                    stack.emplace_back(std::distance(perm_.data(), middle), hi);
+                    continue;
+                }
+                for(unsigned short it = 0; it < 8; ++it) {
+                    int candidate = queue[count - 1];
+                    for(int i = count - 1; i >= 0 && level[queue[i]] == depth - 1; --i)
+                        if(xadj[queue[i] + 1] - xadj[queue[i]] < xadj[candidate + 1] - xadj[candidate])
+                            candidate = queue[i];
+                    const int eccentricity = bfs(candidate, lo, hi, count);
+                    if(eccentricity <= depth) {
+                        bfs(root, lo, hi, count);
+                        break;
+                    }
+                    depth = eccentricity;
+                    root = candidate;
+                }
+                if(depth < 3)
+                    continue;
+                const int m = std::min(std::max(level[queue[count / 2]], 1), depth - 2);
+                int a = lo, b = 0, s = 0;
+                for(int i = 0; i < count; ++i) {
+                    const int v = queue[i];
+                    if(level[v] < m)
+                        perm_[a++] = v;
+                    else if(level[v] > m)
+                        tmp[b++] = v;
+                    else {
+                        int p = xadj[v];
+                        while(p < xadj[v + 1] && !(stamp[adj[p]] == id && level[adj[p]] == m + 1))
+                            ++p;
+                        if(p == xadj[v + 1])
+                            perm_[a++] = v;
+                        else
+                            tmp[hi - lo - 1 - s++] = v;
+                    }
+                }
+                std::copy_n(tmp.cbegin(), b, perm_.begin() + a);
+                std::reverse_copy(tmp.cbegin() + hi - lo - s, tmp.cbegin() + hi - lo, perm_.begin() + hi - s);
+                stack.emplace_back(lo, a);
+                stack.emplace_back(a, a + b);
+            }
+        }
+        /* Function: etree
+         *  Computes the elimination tree of the permuted symmetrized pattern. */
+        void etree(const std::vector<int>& xadj, const std::vector<int>& adj, std::vector<int>& parent) const {
+            std::vector<int> ancestor(n_, -1);
+            parent.assign(n_, -1);
+            for(int k = 0; k < n_; ++k)
+                for(int p = xadj[perm_[k]]; p < xadj[perm_[k] + 1]; ++p)
+                    for(int i = iperm_[adj[p]], next; i != -1 && i < k; i = next) {
+                        next = ancestor[i];
+                        ancestor[i] = k;
+                        if(next == -1)
+                            parent[i] = k;
+                    }
+        }
+        /* Function: analyze
+         *  Symbolic factorization: ordering, supernode partition, row structures, and assembly map. */
+        template<char N>
+        void analyze(const MatrixCSR<K>* const A) {
+            std::vector<int> xadj(n_ + 1), adj, mark(n_, -1);
+            for(int i = 0; i < n_; ++i)
+                for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                    const int col = A->ja_[j] - (N == 'F');
+                    if(col != i) {
+                        ++xadj[i + 1];
+                        ++xadj[col + 1];
+                    }
+                }
+            std::partial_sum(xadj.cbegin(), xadj.cend(), xadj.begin());
+            adj.resize(xadj[n_]);
+            {
+                std::vector<int> fill(xadj.cbegin(), xadj.cend() - 1);
+                for(int i = 0; i < n_; ++i)
+                    for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                        const int col = A->ja_[j] - (N == 'F');
+                        if(col != i) {
+                            adj[fill[i]++] = col;
+                            adj[fill[col]++] = i;
+                        }
+                    }
+                int nnz = 0;
+                for(int i = 0; i < n_; ++i) {
+                    const int start = nnz;
+                    for(int p = xadj[i]; p < xadj[i + 1]; ++p)
+                        if(mark[adj[p]] != i) {
+                            mark[adj[p]] = i;
+                            adj[nnz++] = adj[p];
+                        }
+                    xadj[i] = start;
+                }
+                xadj[n_] = nnz;
+                adj.resize(nnz);
+            }
+            order(xadj, adj);
+            iperm_.resize(n_);
+            for(int i = 0; i < n_; ++i)
+                iperm_[perm_[i]] = i;
+            std::vector<int> parent, head(n_, -1), next(n_), post;
+            etree(xadj, adj, parent);
+            for(int j = n_ - 1; j >= 0; --j)
+                if(parent[j] != -1) {
+                    next[j] = head[parent[j]];
+                    head[parent[j]] = j;
+                }
+            post.reserve(n_);
+            {
+                std::vector<int> stack;
+                for(int j = 0; j < n_; ++j) {
+                    if(parent[j] != -1)
+                        continue;
+                    stack.emplace_back(j);
+                    while(!stack.empty()) {
+                        const int p = stack.back();
+                        if(head[p] == -1) {
+                            stack.pop_back();
+                            post.emplace_back(p);
+                        }
+                        else {
+                            const int c = head[p];
+                            head[p] = next[c];
+                            stack.emplace_back(c);
+                        }
+                    }
+                }
+            }
+            for(int k = 0; k < n_; ++k)
+                post[k] = perm_[post[k]];
+            perm_.swap(post);
+            for(int i = 0; i < n_; ++i)
+                iperm_[perm_[i]] = i;
+            etree(xadj, adj, parent);
+            std::vector<int> cc(n_), children(n_);
+            std::fill(mark.begin(), mark.end(), -1);
+            for(int i = 0; i < n_; ++i) {
+                mark[i] = i;
+                for(int p = xadj[perm_[i]]; p < xadj[perm_[i] + 1]; ++p)
+                    for(int j = iperm_[adj[p]]; j < i && mark[j] != i; j = parent[j]) {
+                        mark[j] = i;
+                        ++cc[j];
+                    }
+                if(parent[i] != -1)
+                    ++children[parent[i]];
+            }
+            super_.assign(1, 0);
+            snode_.resize(n_);
+            for(int j = 0; j < n_; ++j) {
+                if(j > 0 && (parent[j - 1] != j || cc[j - 1] != cc[j] + 1 || children[j] != 1))
+                    super_.emplace_back(j);
+                snode_[j] = super_.size() - 1;
+            }
+            super_.emplace_back(n_);
+            const int nsuper = super_.size() - 1;
+            rowptr_.resize(nsuper + 1);
+            rowptr_[0] = 0;
+            for(int s = 0; s < nsuper; ++s)
+                rowptr_[s + 1] = rowptr_[s] + cc[super_[s]] + 1;
+            rows_.resize(rowptr_[nsuper]);
+            std::fill_n(head.begin(), nsuper, -1);
+            std::fill(mark.begin(), mark.end(), -1);
+            lptr_.resize(nsuper + 1);
+            uptr_.resize(nsuper + 1);
+            lptr_[0] = 0;
+            maxSize_ = 0;
+            for(int s = 0; s < nsuper; ++s) {
+                const int f = super_[s], l = super_[s + 1];
+                int* const rs = rows_.data() + rowptr_[s];
+                int nr = 0;
+                for(int j = f; j < l; ++j) {
+                    mark[j] = s;
+                    rs[nr++] = j;
+                }
+                for(int c = head[s]; c != -1; c = next[c])
+                    for(int p = rowptr_[c] + super_[c + 1] - super_[c]; p < rowptr_[c + 1]; ++p)
+                        if(rows_[p] >= l && mark[rows_[p]] != s) {
+                            mark[rows_[p]] = s;
+                            rs[nr++] = rows_[p];
+                        }
+                for(int j = f; j < l; ++j)
+                    for(int p = xadj[perm_[j]]; p < xadj[perm_[j] + 1]; ++p) {
+                        const int i = iperm_[adj[p]];
+                        if(i >= l && mark[i] != s) {
+                            mark[i] = s;
+                            rs[nr++] = i;
+                        }
+                    }
+                std::sort(rs + l - f, rs + nr);
+                if(parent[l - 1] != -1) {
+                    const int t = snode_[parent[l - 1]];
+                    next[s] = head[t];
+                    head[t] = s;
+                }
+                lptr_[s + 1] = lptr_[s] + static_cast<std::size_t>(nr) * (l - f);
+                maxSize_ = std::max(maxSize_, nr);
+            }
+            uptr_[0] = lptr_[nsuper];
+            for(int s = 0; s < nsuper; ++s)
+                uptr_[s + 1] = uptr_[s] + (sym_ ? 0 : static_cast<std::size_t>(rowptr_[s + 1] - rowptr_[s] - super_[s + 1] + super_[s]) * (super_[s + 1] - super_[s]));
+            values_.resize(uptr_[nsuper]);
+            dest_.resize(nnz_);
+            for(int i = 0; i < n_; ++i)
+                for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                    const int r = iperm_[i], c = iperm_[A->ja_[j] - (N == 'F')];
+                    if(sym_ || r >= c)
+                        dest_[j] = lptr_[snode_[std::min(r, c)]] + local(std::max(r, c), std::min(r, c));
+                    else {
+                        const int s = snode_[r], nc = super_[s + 1] - super_[s], nr = rowptr_[s + 1] - rowptr_[s];
+                        if(c < super_[s + 1])
+                            dest_[j] = lptr_[s] + local(r, c);
+                        else
+                            dest_[j] = uptr_[s] + (index(s, c) - nc) + static_cast<std::size_t>(r - super_[s]) * (nr - nc);
+                    }
+                }
+        }
+        /* Function: index
+         *  Returns the position of a row in the structure of a supernode. */
+        int index(int s, int r) const {
+            const int f = super_[s], l = super_[s + 1];
+            if(r < l)
+                return r - f;
+            return std::distance(rows_.data() + rowptr_[s], std::lower_bound(rows_.data() + rowptr_[s] + l - f, rows_.data() + rowptr_[s + 1], r));
+        }
+        /* Function: local
+         *  Returns the offset of an entry of the lower panel of the supernode of its column. */
+        std::size_t local(int r, int c) const {
+            const int s = snode_[c];
+            return index(s, r) + static_cast<std::size_t>(c - super_[s]) * (rowptr_[s + 1] - rowptr_[s]);
+        }
+        /* Function: ldlt
+         *  Computes a blocked LDL<sup>T</sup> factorization without pivoting of a panel, with the diagonal stored in place of the unit diagonal. */
+        void ldlt(K* const L, const int nr, const int nc, const underlying_type<K> tol, K* const W) {
+            constexpr int bs = 64;
+            const char trans = (type_ == 3 ? Wrapper<K>::transc : 'T');
+            for(int kb = 0; kb < nc; kb += bs) {
+                const int ke = std::min(kb + bs, nc);
+                for(int k = kb; k < ke; ++k) {
+                    K& d = L[k + static_cast<std::size_t>(k) * nr];
+                    if(std::abs(d) <= tol) {
+                        d = HPDDM_PEN;
+                        ++deficiency_;
+                    }
+                    const K inv = K(1.0) / d;
+                    for(int i = k + 1; i < nr; ++i)
+                        L[i + static_cast<std::size_t>(k) * nr] *= inv;
+                    for(int j = k + 1; j < ke; ++j) {
+                        const K t = (type_ == 3 ? Wrapper<K>::conj(L[j + static_cast<std::size_t>(k) * nr]) : L[j + static_cast<std::size_t>(k) * nr]) * d;
+                        for(int i = j; i < nr; ++i)
+                            L[i + static_cast<std::size_t>(j) * nr] -= L[i + static_cast<std::size_t>(k) * nr] * t;
+                    }
+                }
+                if(ke < nc) {
+                    const int m = nc - ke, w = ke - kb, rows = nr - ke;
+                    for(int j = 0; j < w; ++j)
+                        for(int i = 0; i < m; ++i)
+                            W[i + j * m] = L[ke + i + static_cast<std::size_t>(kb + j) * nr] * L[kb + j + static_cast<std::size_t>(kb + j) * nr];
+                    Blas<K>::gemm("N", &trans, &rows, &m, &w, &(Wrapper<K>::d__2), L + ke + static_cast<std::size_t>(kb) * nr, &nr, W, &m, &(Wrapper<K>::d__1), L + ke + static_cast<std::size_t>(ke) * nr, &nr);
+                }
+            }
+        }
+        /* Function: factorize
+         *  Numerical factorization, assuming <Supernodal Sub::analyze> has been called on a matrix with the same pattern. Returns false if an LL<sup>H</sup> factorization breaks down. */
+        template<char N>
+        bool factorize(const MatrixCSR<K>* const A) {
+            std::fill(values_.begin(), values_.end(), K());
+            underlying_type<K> tol = 0.0;
+            for(int i = 0; i < n_; ++i)
+                for(int j = A->ia_[i] - (N == 'F'); j < A->ia_[i + 1] - (N == 'F'); ++j) {
+                    const int col = A->ja_[j] - (N == 'F');
+                    values_[dest_[j]] += (type_ >= 2 && iperm_[i] < iperm_[col] ? Wrapper<K>::conj(A->a_[j]) : A->a_[j]);
+                    if(col == i)
+                        tol = std::max(tol, std::abs(A->a_[j]));
+                }
+            tol *= HPDDM_EPS;
+            deficiency_ = 0;
+            const int nsuper = super_.size() - 1;
+            int maxCol = 0;
+            for(int s = 0; s < nsuper; ++s)
+                maxCol = std::max(maxCol, super_[s + 1] - super_[s]);
+            std::vector<int> map(n_), head(nsuper, -1), next(nsuper), pos(nsuper);
+            std::vector<K> C(2 * static_cast<std::size_t>(maxSize_) * maxCol + static_cast<std::size_t>(maxCol) * std::min(maxCol, 64));
+            K* const C2 = C.data() + static_cast<std::size_t>(maxSize_) * maxCol;
+            K* const W = C2 + static_cast<std::size_t>(maxSize_) * maxCol;
+            ipiv_.resize(sym_ ? 0 : n_);
+            const char trans = (type_ == 1 ? 'T' : Wrapper<K>::transc);
+            for(int s = 0; s < nsuper; ++s) {
+                const int f = super_[s], l = super_[s + 1], nc = l - f, nr = rowptr_[s + 1] - rowptr_[s];
+                const int* const rs = rows_.data() + rowptr_[s];
+                for(int i = 0; i < nr; ++i)
+                    map[rs[i]] = i;
+                K* const Ls = values_.data() + lptr_[s];
+                K* const Us = values_.data() + uptr_[s];
+                for(int d = head[s], dn; d != -1; d = dn) {
+                    dn = next[d];
+                    const int* const rd = rows_.data() + rowptr_[d];
+                    const int nrd = rowptr_[d + 1] - rowptr_[d], k = super_[d + 1] - super_[d], p1 = pos[d];
+                    int p2 = p1;
+                    while(p2 < nrd && rd[p2] < l)
+                        ++p2;
+                    const int m = nrd - p1, w = p2 - p1;
+                    const K* const Ld = values_.data() + lptr_[d];
+                    if(type_ & 1) {
+                        K* const X = C2;
+                        for(int j = 0; j < k; ++j)
+                            for(int i = 0; i < w; ++i)
+                                X[i + j * w] = Ld[p1 + i + static_cast<std::size_t>(j) * nrd] * Ld[j + static_cast<std::size_t>(j) * nrd];
+                        Blas<K>::gemm("N", &trans, &m, &w, &k, &(Wrapper<K>::d__1), Ld + p1, &nrd, X, &w, &(Wrapper<K>::d__0), C.data(), &m);
+                    }
+                    else if(type_ == 2)
+                        Blas<K>::gemm("N", &trans, &m, &w, &k, &(Wrapper<K>::d__1), Ld + p1, &nrd, Ld + p1, &nrd, &(Wrapper<K>::d__0), C.data(), &m);
+                    else {
+                        const K* const Ud = values_.data() + uptr_[d];
+                        const int ldu = nrd - k, r = nrd - p2;
+                        Blas<K>::gemm("N", "T", &m, &w, &k, &(Wrapper<K>::d__1), Ld + p1, &nrd, Ud + p1 - k, &ldu, &(Wrapper<K>::d__0), C.data(), &m);
+                        if(r) {
+                            Blas<K>::gemm("N", "T", &r, &w, &k, &(Wrapper<K>::d__1), Ud + p2 - k, &ldu, Ld + p1, &nrd, &(Wrapper<K>::d__0), C2, &r);
+                            for(int j = 0; j < w; ++j)
+                                for(int i = 0; i < r; ++i)
+                                    Us[map[rd[p2 + i]] - nc + static_cast<std::size_t>(rd[p1 + j] - f) * (nr - nc)] -= C2[i + j * r];
+                        }
+                    }
+                    for(int j = 0; j < w; ++j)
+                        for(int i = (type_ ? j : 0); i < m; ++i)
+                            Ls[map[rd[p1 + i]] + static_cast<std::size_t>(rd[p1 + j] - f) * nr] -= C[i + j * m];
+                    pos[d] = p2;
+                    if(p2 < nrd) {
+                        const int t = snode_[rd[p2]];
+                        next[d] = head[t];
+                        head[t] = d;
+                    }
+                }
+                int info, off = nr - nc;
+                if(type_ & 1)
+                    ldlt(Ls, nr, nc, tol, W);
+                else if(type_ == 2) {
+                    Lapack<K>::potrf("L", &nc, Ls, &nr, &info);
+                    if(info)
+                        return false;
+                    if(off)
+                        Blas<K>::trsm("R", "L", &(Wrapper<K>::transc), "N", &off, &nc, &(Wrapper<K>::d__1), Ls, &nr, Ls + nc, &nr);
+                }
+                else {
+                    Lapack<K>::getrf(&nc, &nc, Ls, &nr, ipiv_.data() + f, &info);
+                    for(int i = 0; i < nc; ++i)
+                        if(std::abs(Ls[i + static_cast<std::size_t>(i) * nr]) <= tol) {
+                            Ls[i + static_cast<std::size_t>(i) * nr] = HPDDM_PEN;
+                            ++deficiency_;
+                        }
+                    if(off) {
+                        Blas<K>::trsm("R", "U", "N", "N", &off, &nc, &(Wrapper<K>::d__1), Ls, &nr, Ls + nc, &nr);
+                        for(int i = 0; i < nc; ++i)
+                            if(ipiv_[f + i] - 1 != i)
+                                std::swap_ranges(Us + static_cast<std::size_t>(i) * off, Us + static_cast<std::size_t>(i + 1) * off, Us + static_cast<std::size_t>(ipiv_[f + i] - 1) * off);
+                        Blas<K>::trsm("R", "L", "T", "U", &off, &nc, &(Wrapper<K>::d__1), Ls, &nr, Us, &off);
+                    }
+                }
+                pos[s] = nc;
+                if(off) {
+                    const int t = snode_[rs[nc]];
+                    next[s] = head[t];
+                    head[t] = s;
+                }
+            }
+            return true;
+        }
+    public:
+        SupernodalSub() : hash_(), n_(), nnz_(), maxSize_(), deficiency_(), type_(), sym_() { }
+        SupernodalSub(const SupernodalSub&) = delete;
+        ~SupernodalSub() { dtor(); }
+        static constexpr char numbering_ = 'C';
+        void dtor() {
+            std::vector<K>().swap(values_);
+            std::vector<K>().swap(work_);
+            std::vector<std::size_t>().swap(dest_);
+            n_ = nnz_ = 0;
+        }
+        /* Function: numfact
+         *
+         *  Factorizes a local matrix. The symbolic analysis is skipped when the pattern of the matrix is the same as the one of the previous call, so that only the numerical factorization is performed.
+         *
+         * Template Parameter:
+         *    N              - 0- or 1-based indexing of the input matrix.
+         *
+         * Parameters:
+         *    A              - Matrix to factorize.
+         *    detection      - Factorize symmetric matrices as LDL<sup>T</sup> even when <Option> operator_spd is set. */
+        template<char N = HPDDM_NUMBERING>
+        void numfact(MatrixCSR<K>* const& A, bool detection = false, K* const& = nullptr) {
+            static_assert(N == 'C' || N == 'F', "Unknown numbering");
+            const std::size_t hash = A->hashIndices();
+            if(A->n_ != n_ || A->nnz_ != nnz_ || A->sym_ != sym_ || hash != hash_ || dest_.empty()) {
+                n_ = A->n_;
+                nnz_ = A->nnz_;
+                sym_ = A->sym_;
+                hash_ = hash;
+                analyze<N>(A);
+            }
+            type_ = sym_ ? 1 + (Option::get()->val<char>("operator_spd", 0) && !detection) : 0;
+            if(!factorize<N>(A)) {
+                if(Option::get()->val<char>("verbosity", 0))
+                    std::cout << "WARNING -- a local matrix of size " << n_ << " is not positive definite, now factorizing it as LDL^H" << std::endl;
+                type_ = 3;
+                factorize<N>(A);
+            }
+        }
+        template<char N = HPDDM_NUMBERING>
+        int inertia(MatrixCSR<K>* const& A) {
+            if(!A->sym_ || Wrapper<K>::is_complex)
+                return 0;
+            numfact<N>(A, true);
+            int negative = 0;
+            for(int s = 0; s < static_cast<int>(super_.size()) - 1; ++s) {
+                const int nr = rowptr_[s + 1] - rowptr_[s];
+                for(int j = 0; j < super_[s + 1] - super_[s]; ++j)
+                    negative += std::real(values_[lptr_[s] + j + static_cast<std::size_t>(j) * nr]) < 0.0;
+            }
+            return negative;
+        }
+        unsigned short deficiency() const { return deficiency_; }
+        /* Function: nnz
+         *  Returns the number of entries of the panels of the factors. */
+        std::size_t nnz() const { return values_.size(); }
+        void solve(K* const x, const unsigned short& n = 1) const {
+            const int mu = n, nsuper = super_.size() - 1;
+            work_.resize(static_cast<std::size_t>(n_ + maxSize_) * mu);
+            K* const w = work_.data();
+            K* const tmp = w + static_cast<std::size_t>(n_) * mu;
+            for(int j = 0; j < mu; ++j)
+                for(int i = 0; i < n_; ++i)
+                    w[i + static_cast<std::size_t>(j) * n_] = x[perm_[i] + static_cast<std::size_t>(j) * n_];
+            const char diag = (type_ == 2 ? 'N' : 'U');
+            const char trans = (type_ >= 2 ? Wrapper<K>::transc : 'T');
+            for(int s = 0; s < nsuper; ++s) {
+                const int f = super_[s], nr = rowptr_[s + 1] - rowptr_[s];
+                int nc = super_[s + 1] - f, off = nr - nc;
+                const int* const rs = rows_.data() + rowptr_[s] + nc;
+                const K* const Ls = values_.data() + lptr_[s];
+                if(type_ == 0)
+                    for(int i = 0; i < nc; ++i)
+                        if(ipiv_[f + i] - 1 != i)
+                            for(int j = 0; j < mu; ++j)
+                                std::swap(w[f + i + static_cast<std::size_t>(j) * n_], w[f + ipiv_[f + i] - 1 + static_cast<std::size_t>(j) * n_]);
+                Blas<K>::trsm("L", "L", "N", &diag, &nc, &mu, &(Wrapper<K>::d__1), Ls, &nr, w + f, &n_);
+                if(off) {
+                    Blas<K>::gemm("N", "N", &off, &mu, &nc, &(Wrapper<K>::d__1), Ls + nc, &nr, w + f, &n_, &(Wrapper<K>::d__0), tmp, &off);
+                    for(int j = 0; j < mu; ++j)
+                        for(int i = 0; i < off; ++i)
+                            w[rs[i] + static_cast<std::size_t>(j) * n_] -= tmp[i + j * off];
+                }
+            }
+            if(type_ & 1)
+                for(int s = 0; s < nsuper; ++s) {
+                    const int nr = rowptr_[s + 1] - rowptr_[s];
+                    for(int i = super_[s]; i < super_[s + 1]; ++i) {
+                        const K d = values_[lptr_[s] + (i - super_[s]) * (static_cast<std::size_t>(nr) + 1)];
+                        for(int j = 0; j < mu; ++j)
+                            w[i + static_cast<std::size_t>(j) * n_] /= d;
+                    }
+                }
+            for(int s = nsuper - 1; s >= 0; --s) {
+                const int f = super_[s], nr = rowptr_[s + 1] - rowptr_[s];
+                int nc = super_[s + 1] - f, off = nr - nc;
+                const int* const rs = rows_.data() + rowptr_[s] + nc;
+                const K* const Ls = values_.data() + lptr_[s];
+                if(off) {
+                    for(int j = 0; j < mu; ++j)
+                        for(int i = 0; i < off; ++i)
+                            tmp[i + j * off] = w[rs[i] + static_cast<std::size_t>(j) * n_];
+                    if(type_ == 0)
+                        Blas<K>::gemm("T", "N", &nc, &mu, &off, &(Wrapper<K>::d__2), values_.data() + uptr_[s], &off, tmp, &off, &(Wrapper<K>::d__1), w + f, &n_);
+                    else
+                        Blas<K>::gemm(&trans, "N", &nc, &mu, &off, &(Wrapper<K>::d__2), Ls + nc, &nr, tmp, &off, &(Wrapper<K>::d__1), w + f, &n_);
+                }
+                if(type_ == 0)
+                    Blas<K>::trsm("L", "U", "N", "N", &nc, &mu, &(Wrapper<K>::d__1), Ls, &nr, w + f, &n_);
+                else
+                    Blas<K>::trsm("L", "L", &trans, &diag, &nc, &mu, &(Wrapper<K>::d__1), Ls, &nr, w + f, &n_);
+            }
+            for(int j = 0; j < mu; ++j)
+                for(int i = 0; i < n_; ++i)
+                    x[perm_[i] + static_cast<std::size_t>(j) * n_] = w[i + static_cast<std::size_t>(j) * n_];
+        }
+        void solve(const K* const b, K* const x, const unsigned short& n = 1) const {
+            std::copy_n(b, n * n_, x);
+            solve(x, n);
+        }
+};
+} // HPDDM
+#endif // HPDDM_SUPERNODAL_HPP_
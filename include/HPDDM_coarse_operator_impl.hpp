@@ -373,7 +373,8 @@ inline typename CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::retur
                              false;
 #endif
 #if !HPDDM_PETSC
-    unsigned short treeDimension = opt.val<unsigned short>("assembly_hierarchy")
+    // when not set by the user, each main process receives from at most 2 * (sqrt(sizeSplit_) - 1) processes instead of sizeSplit_ - 1
+    unsigned short treeDimension = opt.val<unsigned short>("assembly_hierarchy", sizeSplit_ > HPDDM_ASSEMBLY_FAN_IN ? static_cast<unsigned short>(std::ceil(std::sqrt(sizeSplit_))) : 0)
 #else
     unsigned short treeDimension = 0
 #endif
@@ -1830,6 +1831,7 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::finishSet
 HPDDM_CLASS_COARSE_OPERATOR(Solver, S, K)
 template<bool excluded>
 inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolver(K* const pt, const unsigned short& mu) {
+    Profiler::Event correction(Profiler::COARSE_CORRECTION, mu * local_ * sizeof(downscaled_type<K>));
     downscaled_type<K>* rhs = reinterpret_cast<downscaled_type<K>*>(pt);
     if(!std::is_same<downscaled_type<K>, K>::value)
         for(int i = 0; i < mu * local_; ++i)
@@ -1850,7 +1852,10 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
                 else if(gatherComm_ != MPI_COMM_NULL)
                     MPI_Gatherv(rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), nullptr, nullptr, nullptr, Wrapper<downscaled_type<K>>::mpi_type(), 0, gatherComm_);
                 if(DMatrix::communicator_ != MPI_COMM_NULL) {
-                    super::template solve<DMatrix::DISTRIBUTED_SOL>(rhs, mu);
+                    {
+                        Profiler::Event event(Profiler::COARSE_SOLVE);
+                        super::template solve<DMatrix::DISTRIBUTED_SOL>(rhs, mu);
+                    }
                     std::for_each(DMatrix::gatherSplitCounts_, DMatrix::displsSplit_ + sizeSplit_, [&](int& i) { i *= mu; });
                     transfer<true>(DMatrix::gatherSplitCounts_, mu, sizeSplit_, rhs);
                 }
@@ -1868,7 +1873,10 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
                 else if(gatherComm_ != MPI_COMM_NULL)
                     MPI_Gather(rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), nullptr, 0, MPI_DATATYPE_NULL, 0, gatherComm_);
                 if(DMatrix::communicator_ != MPI_COMM_NULL) {
-                    super::template solve<DMatrix::DISTRIBUTED_SOL>(rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), mu);
+                    {
+                        Profiler::Event event(Profiler::COARSE_SOLVE);
+                        super::template solve<DMatrix::DISTRIBUTED_SOL>(rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), mu);
+                    }
                     Wrapper<downscaled_type<K>>::template cycle<'T'>(mu, sizeSplit_ - (offset_ || excluded), rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), *DMatrix::gatherCounts_);
                     MPI_Scatter(rhs, mu * *DMatrix::gatherCounts_, Wrapper<downscaled_type<K>>::mpi_type(), MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, 0, scatterComm_);
                 }
@@ -1888,8 +1896,10 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
                 }
                 else if(gatherComm_ != MPI_COMM_NULL)
                     MPI_Gatherv(rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), nullptr, nullptr, nullptr, Wrapper<downscaled_type<K>>::mpi_type(), 0, gatherComm_);
-                if(DMatrix::communicator_ != MPI_COMM_NULL)
+                if(DMatrix::communicator_ != MPI_COMM_NULL) {
+                    Profiler::Event event(Profiler::COARSE_SOLVE);
                     super::template solve<DMatrix::CENTRALIZED>(rhs, mu);
+                }
                 if(rankWorld_ == 0)
                     transfer<true>(DMatrix::gatherCounts_, mu, sizeWorld_ - p, rhs);
                 else if(gatherComm_ != MPI_COMM_NULL)
@@ -1904,8 +1914,10 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
                 }
                 else
                     MPI_Gather(rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), nullptr, 0, MPI_DATATYPE_NULL, 0, gatherComm_);
-                if(DMatrix::communicator_ != MPI_COMM_NULL)
+                if(DMatrix::communicator_ != MPI_COMM_NULL) {
+                    Profiler::Event event(Profiler::COARSE_SOLVE);
                     super::template solve<DMatrix::CENTRALIZED>(rhs + (offset_ || excluded ? mu * local_ : 0), mu);
+                }
                 if(rankWorld_ == 0) {
                     Wrapper<downscaled_type<K>>::template cycle<'T'>(mu, sizeWorld_ - p, rhs + (p ? mu * *DMatrix::gatherCounts_ : 0), *DMatrix::gatherCounts_);
                     MPI_Scatter(rhs, mu * *DMatrix::gatherCounts_, Wrapper<downscaled_type<K>>::mpi_type(), MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, 0, scatterComm_);
@@ -1918,14 +1930,19 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
             if(DMatrix::displs_) {
                 if(DMatrix::communicator_ != MPI_COMM_NULL) {
                     transfer<false>(DMatrix::gatherSplitCounts_, sizeSplit_, mu, rhs);
-                    PetscCallVoid(super::solve(rhs, mu));
+                    {
+                        Profiler::Event event(Profiler::COARSE_SOLVE);
+                        PetscCallVoid(super::solve(rhs, mu));
+                    }
                     transfer<true>(DMatrix::gatherSplitCounts_, mu, sizeSplit_, rhs);
                 }
                 else {
                     MPI_Gatherv(rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), nullptr, nullptr, nullptr, Wrapper<downscaled_type<K>>::mpi_type(), 0, gatherComm_);
 #if HPDDM_PETSC && defined(PETSC_HAVE_MUMPS)
-                    if(super::s_)
+                    if(super::s_) {
+                        Profiler::Event event(Profiler::COARSE_SOLVE);
                         PetscCallVoid(super::solve(nullptr, mu));
+                    }
 #endif
                     MPI_Scatterv(nullptr, nullptr, nullptr, Wrapper<downscaled_type<K>>::mpi_type(), rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), 0, scatterComm_);
                 }
@@ -1934,15 +1951,20 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
                 if(DMatrix::communicator_ != MPI_COMM_NULL) {
                     MPI_Gather(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, rhs, mu * *DMatrix::gatherCounts_, Wrapper<downscaled_type<K>>::mpi_type(), 0, gatherComm_);
                     Wrapper<downscaled_type<K>>::template cycle<'T'>(sizeSplit_ - (offset_ || excluded), mu, rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), *DMatrix::gatherCounts_);
-                    PetscCallVoid(super::solve(rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), mu));
+                    {
+                        Profiler::Event event(Profiler::COARSE_SOLVE);
+                        PetscCallVoid(super::solve(rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), mu));
+                    }
                     Wrapper<downscaled_type<K>>::template cycle<'T'>(mu, sizeSplit_ - (offset_ || excluded), rhs + (offset_ || excluded ? mu * *DMatrix::gatherCounts_ : 0), *DMatrix::gatherCounts_);
                     MPI_Scatter(rhs, mu * *DMatrix::gatherCounts_, Wrapper<downscaled_type<K>>::mpi_type(), MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, 0, scatterComm_);
                 }
                 else {
                     MPI_Gather(rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), nullptr, 0, MPI_DATATYPE_NULL, 0, gatherComm_);
 #if HPDDM_PETSC && defined(PETSC_HAVE_MUMPS)
-                    if(super::s_)
+                    if(super::s_) {
+                        Profiler::Event event(Profiler::COARSE_SOLVE);
                         PetscCallVoid(super::solve(nullptr, mu));
+                    }
 #endif
                     MPI_Scatter(nullptr, 0, Wrapper<downscaled_type<K>>::mpi_type(), rhs, mu * local_, Wrapper<downscaled_type<K>>::mpi_type(), 0, scatterComm_);
                 }
@@ -1950,6 +1972,7 @@ inline void CoarseOperator<HPDDM_TYPES_COARSE_OPERATOR(Solver, S, K)>::callSolve
 #endif
     }
     else if(DMatrix::communicator_ != MPI_COMM_NULL) {
+        Profiler::Event event(Profiler::COARSE_SOLVE);
 #if defined(DMUMPS) && !HPDDM_INEXACT_COARSE_OPERATOR
         if(DMatrix::distribution_ == DMatrix::DISTRIBUTED_SOL)
             super::template solve<DMatrix::DISTRIBUTED_SOL>(rhs, mu);
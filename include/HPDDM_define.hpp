@@ -29,6 +29,10 @@
  *    HPDDM_EPS           - Small positive number used internally for dropping values.
  *    HPDDM_PEN           - Large positive number used externally for penalization, e.g. for imposing Dirichlet boundary conditions.
  *    HPDDM_GRANULARITY   - Granularity for OpenMP scheduling.
+ *    HPDDM_SUPERNODAL_LEAF - Size under which subgraphs are no longer bisected by the nested dissection of <Supernodal Sub>.
+ *    HPDDM_ASSEMBLY_FAN_IN - Number of processes per main process above which coarse operators are assembled with a two-level tree when the option assembly_hierarchy is not set.
+ *    HPDDM_SCRATCH_SIZE  - Size in bytes above which the work arrays of the sparse matrix products of <Wrapper> are released after each product instead of being kept for the next ones.
+ *    HPDDM_SCHUR_FILL    - Ratio between the number of nonzero entries of the factors of interior matrices and of the matrices themselves, assumed by <Schur::callNumfactPreconditioner> when the local solver does not report it.
  *    HPDDM_MPI           - If not set to zero, MPI is supposed to be activated during compilation and for running the library.
  *    HPDDM_MKL           - If not set to zero, Intel MKL is chosen as the linear algebra backend.
  *    HPDDM_OPENBLAS      - If not set to zero, OpenBLAS is chosen as the linear algebra backend.
@@ -41,6 +45,7 @@
  *    HPDDM_SLEPC         - PETSc compiled with SLEPc.
  *    HPDDM_QR            - If not set to zero, pseudo-inverses of Schur complements are computed using dense QR decompositions (with pivoting if set to one, without pivoting otherwise).
  *    HPDDM_ICOLLECTIVE   - If possible, use nonblocking MPI collective operations.
+ *    HPDDM_NEIGHBOR_COLLECTIVE - Exchange values with neighboring subdomains using MPI-3 neighborhood collective operations on a distributed graph communicator.
  *    HPDDM_MIXED_PRECISION - Use mixed precision arithmetic for the assembly of coarse operators.
  *    HPDDM_INEXACT_COARSE_OPERATOR - Solve coarse systems using a Krylov method.
  *    HPDDM_LIBXSMM       - Block sparse matrices products are computed using LIBXSMM. */
@@ -48,6 +53,18 @@
 #define HPDDM_EPS                                       1.0e-12
 #define HPDDM_PEN                                       1.0e+30
 #define HPDDM_GRANULARITY                               50000
+#ifndef HPDDM_SUPERNODAL_LEAF
+# define HPDDM_SUPERNODAL_LEAF                          64
+#endif
+#ifndef HPDDM_ASSEMBLY_FAN_IN
+# define HPDDM_ASSEMBLY_FAN_IN                          64
+#endif
+#ifndef HPDDM_SCRATCH_SIZE
+# define HPDDM_SCRATCH_SIZE                             (1 << 24)
+#endif
+#ifndef HPDDM_SCHUR_FILL
+# define HPDDM_SCHUR_FILL                               10
+#endif
 #if !defined(HPDDM_PETSC) && defined(PETSC_PCHPDDM_MAXLEVELS)
 # define HPDDM_PETSC                                    1
 #endif
@@ -129,6 +146,9 @@ static_assert(HPDDM_NUMBERING == 'C' || HPDDM_NUMBERING == 'F', "Unknown numberi
 #ifndef HPDDM_ICOLLECTIVE
 # define HPDDM_ICOLLECTIVE                              0
 #endif
+#ifndef HPDDM_NEIGHBOR_COLLECTIVE
+# define HPDDM_NEIGHBOR_COLLECTIVE                      0
+#endif
 #ifndef HPDDM_MIXED_PRECISION
 # define HPDDM_MIXED_PRECISION                          0
 #endif
@@ -145,6 +165,7 @@ static_assert(HPDDM_NUMBERING == 'C' || HPDDM_NUMBERING == 'F', "Unknown numberi
 
 #define HPDDM_ORTHOGONALIZATION_CGS                     0
 #define HPDDM_ORTHOGONALIZATION_MGS                     1
+#define HPDDM_ORTHOGONALIZATION_SRCGS                   2
 
 #define HPDDM_KRYLOV_METHOD_GMRES                       0
 #define HPDDM_KRYLOV_METHOD_BGMRES                      1
@@ -155,6 +176,7 @@ static_assert(HPDDM_NUMBERING == 'C' || HPDDM_NUMBERING == 'F', "Unknown numberi
 #define HPDDM_KRYLOV_METHOD_BFBCG                       6
 #define HPDDM_KRYLOV_METHOD_RICHARDSON                  7
 #define HPDDM_KRYLOV_METHOD_NONE                        8
+#define HPDDM_KRYLOV_METHOD_PIPECG                      9
 
 #define HPDDM_VARIANT_LEFT                              0
 #define HPDDM_VARIANT_RIGHT                             1
@@ -195,6 +217,10 @@ static_assert(HPDDM_NUMBERING == 'C' || HPDDM_NUMBERING == 'F', "Unknown numberi
 #define HPDDM_SUBSTRUCTURING_SCALING_STIFFNESS          1
 #define HPDDM_SUBSTRUCTURING_SCALING_COEFFICIENT        2
 
+#define HPDDM_SUBSTRUCTURING_SCHUR_COMPLEMENT_AUTO      0
+#define HPDDM_SUBSTRUCTURING_SCHUR_COMPLEMENT_IMPLICIT  1
+#define HPDDM_SUBSTRUCTURING_SCHUR_COMPLEMENT_EXPLICIT  2
+
 #define HPDDM_HYPRE_SOLVER_FGMRES                       0
 #define HPDDM_HYPRE_SOLVER_PCG                          1
 #define HPDDM_HYPRE_SOLVER_AMG                          2
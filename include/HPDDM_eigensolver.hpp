@@ -54,14 +54,105 @@ class Eigensolver {
         /* Variable: n
          *  Number of rows of the eigenvalue problem. */
         int                        n_;
+        /* Variable: x
+         *  Initial block of vectors. */
+        const K* const*            x_;
+        /* Variable: k
+         *  Number of vectors in <Eigensolver::x>. */
+        int                        k_;
+        /* Function: apply
+         *  Computes the product of a sparse or dense matrix, or of the identity if the matrix is null, with a block of vectors. */
+        void apply(const MatrixCSR<K>* const M, const K* const in, K* const out, int mu) const {
+            const int* const n = &n_;
+            if(!M)
+                std::copy_n(in, *n * mu, out);
+            else if(M->ia_ && M->ja_)
+                Wrapper<K>::csrmm(M->sym_, n, &mu, M->a_, M->ia_, M->ja_, in, out);
+            else if(M->sym_)
+                Blas<K>::symm("L", "L", n, &mu, &(Wrapper<K>::d__1), M->a_, n, in, n, &(Wrapper<K>::d__0), out, n);
+            else
+                Blas<K>::gemm("N", "N", n, &mu, n, &(Wrapper<K>::d__1), M->a_, n, in, n, &(Wrapper<K>::d__0), out, n);
+        }
+        /* Function: apply
+         *  Computes the products of B and of A + B with a block of vectors. */
+        void apply(const MatrixCSR<K>* const A, const MatrixCSR<K>* const B, const K* const in, K* const MV, K* const BV, int mu) const {
+            const int size = n_ * mu;
+            apply(B, in, BV, mu);
+            apply(A, in, MV, mu);
+            Blas<K>::axpy(&size, &(Wrapper<K>::d__1), BV, &i__1, MV, &i__1);
+        }
+        /* Function: rayleighRitz
+         *  Computes all eigenpairs, in ascending order, of a small Hermitian matrix whose lower triangular part is overwritten. */
+        static void rayleighRitz(int s, K* const H, underlying_type<K>* const w, K* const Z) {
+            int info, lwork = -1, m, nsplit;
+            {
+                K wkopt;
+                Lapack<K>::trd("L", &s, nullptr, &s, nullptr, nullptr, nullptr, &wkopt, &lwork, &info);
+                lwork = std::max(static_cast<int>(std::real(wkopt)), s);
+            }
+            std::vector<K> work(lwork + s);
+            std::vector<underlying_type<K>> rwork(7 * s);
+            std::vector<int> iwork(6 * s);
+            underlying_type<K>* const d = rwork.data() + 5 * s;
+            underlying_type<K>* const e = d + s;
+            Lapack<K>::trd("L", &s, H, &s, d, e, work.data() + lwork, work.data(), &lwork, &info);
+            const underlying_type<K> vl = 0.0, vu = 0.0, abstol = 0.0;
+            Lapack<K>::stebz("A", "E", &s, &vl, &vu, &i__1, &s, &abstol, d, e, &m, &nsplit, w, iwork.data(), iwork.data() + s, rwork.data(), iwork.data() + 2 * s, &info);
+            Lapack<K>::stein(&s, d, e, &m, w, iwork.data(), iwork.data() + s, Z, &s, rwork.data(), iwork.data() + 2 * s, iwork.data() + 3 * s, &info);
+            Lapack<K>::mtr("L", "L", "N", &s, &m, H, &s, work.data() + lwork, Z, &s, work.data(), &lwork, &info);
+        }
     public:
         /* Variable: nu
          *  Number of desired eigenvalues. */
         int                       nu_;
-        explicit Eigensolver(int n)                                                      : tol_(), threshold_(), n_(n), nu_() { }
-        Eigensolver(int n, int nu)                                                       : tol_(Option::get()->val("eigensolver_tol", 1.0e-6)), threshold_(), n_(n), nu_(std::min(nu, n)) { }
-        Eigensolver(underlying_type<K> threshold, int n, int nu)                         : tol_(threshold > 0.0 ? HPDDM_EPS : Option::get()->val("eigensolver_tol", 1.0e-6)), threshold_(threshold), n_(n), nu_(std::min(nu, n)) { }
-        Eigensolver(underlying_type<K> tol, underlying_type<K> threshold, int n, int nu) : tol_(threshold > 0.0 ? HPDDM_EPS : tol), threshold_(threshold), n_(n), nu_(std::min(nu, n)) { }
+        explicit Eigensolver(int n)                                                      : tol_(), threshold_(), n_(n), x_(), k_(), nu_() { }
+        Eigensolver(int n, int nu)                                                       : tol_(Option::get()->val("eigensolver_tol", 1.0e-6)), threshold_(), n_(n), x_(), k_(), nu_(std::min(nu, n)) { }
+        Eigensolver(underlying_type<K> threshold, int n, int nu)                         : tol_(threshold > 0.0 ? HPDDM_EPS : Option::get()->val("eigensolver_tol", 1.0e-6)), threshold_(threshold), n_(n), x_(), k_(), nu_(std::min(nu, n)) { }
+        Eigensolver(underlying_type<K> tol, underlying_type<K> threshold, int n, int nu) : tol_(threshold > 0.0 ? HPDDM_EPS : tol), threshold_(threshold), n_(n), x_(), k_(), nu_(std::min(nu, n)) { }
+        /* Function: initialize
+         *
+         *  Sets the initial block of vectors of the eigenvalue problem solver, e.g., eigenvectors of a nearby problem.
+         *
+         * Parameters:
+         *    x              - Array of vectors.
+         *    k              - Number of vectors. */
+        void initialize(const K* const* x, int k) {
+            x_ = x;
+            k_ = x ? k : 0;
+        }
+        /* Function: check
+         *
+         *  Computes the Rayleigh quotients of a block of vectors and their relative residuals with respect to the generalized eigenvalue problem Ax = l Bx.
+         *
+         * Parameters:
+         *    A              - Left-hand side matrix.
+         *    B              - Right-hand side matrix.
+         *    ev             - Array of vectors.
+         *    k              - Number of vectors.
+         *    evr            - Array of Rayleigh quotients.
+         *
+         * Returns the maximum relative residual. */
+        underlying_type<K> check(const MatrixCSR<K>* const A, const MatrixCSR<K>* const B, const K* const* const ev, int k, underlying_type<K>* const evr) const {
+            if(k == 0)
+                return underlying_type<K>();
+            std::vector<K> work(2 * n_ * k);
+            K* const AX = work.data();
+            K* const BX = AX + n_ * k;
+            apply(A, *ev, AX, k);
+            apply(B, *ev, BX, k);
+            underlying_type<K> max = 0.0;
+            for(int i = 0; i < k; ++i) {
+                const K alpha = std::real(Blas<K>::dot(&n_, ev[i], &i__1, AX + i * n_, &i__1));
+                const K beta = std::real(Blas<K>::dot(&n_, ev[i], &i__1, BX + i * n_, &i__1));
+                const underlying_type<K> scale = std::abs(beta) * Blas<K>::nrm2(&n_, AX + i * n_, &i__1) + std::abs(alpha) * Blas<K>::nrm2(&n_, BX + i * n_, &i__1);
+                Blas<K>::scal(&n_, &beta, AX + i * n_, &i__1);
+                const K mAlpha = -alpha;
+                Blas<K>::axpy(&n_, &mAlpha, BX + i * n_, &i__1, AX + i * n_, &i__1);
+                max = std::max(max, scale > 0.0 ? Blas<K>::nrm2(&n_, AX + i * n_, &i__1) / scale : underlying_type<K>(1.0));
+                evr[i] = std::real(beta) > HPDDM_EPS * std::abs(alpha) ? std::real(alpha / beta) : 1.0 / HPDDM_EPS;
+            }
+            return max;
+        }
         std::string dump(const K* const eigenvalues, const K* const* const eigenvectors, const MPI_Comm& communicator, std::ios_base::openmode mode = std::ios_base::out) const {
             int rankWorld;
             MPI_Comm_rank(communicator, &rankWorld);
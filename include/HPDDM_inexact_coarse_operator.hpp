@@ -762,7 +762,7 @@ class InexactCoarseOperator : public OptionsPrefix<K>, public Solver
                     std::copy_n(rhs + i * dof_ * bs_, dof_ * bs_, in + i * n);
                     std::fill(in + i * n + dof_ * bs_, in + (i + 1) * n, K());
                 }
-                bool allocate = s_->setBuffer();
+                bool allocate = s_->setBuffer(nullptr, 0, mu);
                 s_->exchange(in, mu);
                 s_->clearBuffer(allocate);
                 IterativeMethod::solve(*s_, in, out, mu, communicator_);
@@ -91,7 +91,7 @@ class IterativeMethod {
                     conv[nu] = i;
 #if !HPDDM_PETSC || defined(PETSCSUB) || defined(MU_SLEPC)
             if(verbosity > 2) {
-                constexpr auto method = (T == 2 ? "CG" : (T == 4 ? "GCRODR" : "GMRES"));
+                constexpr auto method = (T == 2 ? "CG" : (T == 4 ? "GCRODR" : (T == 7 ? "PCG" : (T == 9 ? "PIPECG" : "GMRES"))));
                 unsigned short tmp[2] { 0, 0 };
                 underlying_type<K> beta = std::abs(res[0]);
                 for(unsigned short nu = 0; nu < mu; ++nu) {
@@ -183,7 +183,7 @@ class IterativeMethod {
         template<char T>
         static void convergence(const char verbosity, const unsigned short i, const unsigned short m) {
             if(verbosity) {
-                constexpr auto method = (T == 1 ? "BGMRES" : (T == 2 ? "CG" : (T == 3 ? "BCG" : (T == 4 ? "GCRODR" : (T == 5 ? "BGCRODR" : (T == 6 ? "BFBCG" : (T == 7 ? "PCG" : "GMRES")))))));
+                constexpr auto method = (T == 1 ? "BGMRES" : (T == 2 ? "CG" : (T == 3 ? "BCG" : (T == 4 ? "GCRODR" : (T == 5 ? "BGCRODR" : (T == 6 ? "BFBCG" : (T == 7 ? "PCG" : (T == 9 ? "PIPECG" : "GMRES"))))))));
                 if(i != m + 1)
                     std::cout << method << " converges after " << i << " iteration" << (i > 1 ? "s" : "") << std::endl;
                 else
@@ -193,31 +193,39 @@ class IterativeMethod {
         template<char T, class K, class Operator>
         static void options(const Operator& A, K* const d, int* const i, unsigned short* const m, char* const id) {
 #if !HPDDM_PETSC
-            const std::string prefix = A.prefix();
-            const Option& opt = *Option::get();
-            m[T == 1 || T == 5 ? 2 : (T == 0 || T == 3 || T == 4 || T == 6 ? 1 : 0)] = std::min(opt.val<short>(prefix + "max_it", 100), std::numeric_limits<short>::max());
+            const auto& opt = A.snapshot();
+            m[T == 1 || T == 5 ? 2 : (T == 0 || T == 3 || T == 4 || T == 6 ? 1 : 0)] = std::min(opt.max_it_, std::numeric_limits<short>::max());
             if(T == 7) {
-                d[0] = opt.val(prefix + "richardson_damping_factor", 1.0);
+                d[0] = opt.richardson_damping_factor_;
                 return;
             }
-            d[T == 1 || T == 5 || T == 6] = opt.val(prefix + "tol", 1.0e-6);
-            id[0] = opt.val<char>(prefix + "verbosity", 0);
+            d[T == 1 || T == 5 || T == 6] = opt.tol_;
+            id[0] = opt.verbosity_;
             if(T == 1 || T == 5 || T == 6) {
-                d[0] = opt.val(prefix + "deflation_tol", -1.0);
-                m[T != 6] = opt.val<unsigned short>(prefix + "enlarge_krylov_subspace", 1);
+                d[0] = opt.deflation_tol_;
+                m[T != 6] = opt.enlarge_krylov_subspace_;
             }
             if(T == 0 || T == 1 || T == 4 || T == 5) {
-                id[2] = opt.val<char>(prefix + "orthogonalization", HPDDM_ORTHOGONALIZATION_CGS) + (opt.val<char>(prefix + "qr", HPDDM_QR_CHOLQR) << 2);
-                m[0] = std::min(static_cast<unsigned short>(std::numeric_limits<short>::max()), std::min(opt.val<unsigned short>(prefix + "gmres_restart", 40), m[T == 1 || T == 5 ? 2 : 1]));
+                id[2] = opt.orthogonalization_ + (opt.qr_ << 2);
+                if((T == 1 || T == 5) && opt.orthogonalization_ == HPDDM_ORTHOGONALIZATION_SRCGS) {
+                    if(id[0])
+                        std::cout << "WARNING -- single-reduction Gram--Schmidt is not implemented for block iterative methods, now switching to cgs" << std::endl;
+                    id[2] = HPDDM_ORTHOGONALIZATION_CGS + (opt.qr_ << 2);
+                }
+                m[0] = std::min(static_cast<unsigned short>(std::numeric_limits<short>::max()), std::min(opt.gmres_restart_, m[T == 1 || T == 5 ? 2 : 1]));
             }
             if(T == 0 || T == 1 || T == 2 || T == 4 || T == 5)
-                id[1] = opt.val<char>(prefix + "variant", HPDDM_VARIANT_RIGHT);
+                id[1] = opt.variant_;
             if(T == 3 || T == 6)
-                id[1] = opt.val<char>(prefix + "qr", HPDDM_QR_CHOLQR);
+                id[1] = opt.qr_;
+            if(T == 8) {
+                m[1] = opt.pcg_window_;
+                m[2] = opt.pcg_recycle_;
+            }
             if(T == 4 || T == 5) {
-                *i = std::min(m[0] - 1, opt.val<int>(prefix + "recycle", 0));
-                id[3] = opt.val<char>(prefix + "recycle_target", HPDDM_RECYCLE_TARGET_SM);
-                id[4] = opt.val<char>(prefix + "recycle_strategy", HPDDM_RECYCLE_STRATEGY_A) + 4 * (std::min(opt.val<unsigned short>(prefix + "recycle_same_system"), (unsigned short)(2)));
+                *i = std::min(m[0] - 1, opt.recycle_);
+                id[3] = opt.recycle_target_;
+                id[4] = opt.recycle_strategy_ + 4 * (std::min(opt.recycle_same_system_, (unsigned short)(2)));
             }
             if(std::abs(d[T == 1 || T == 5 || T == 6]) < std::numeric_limits<underlying_type<K>>::epsilon()) {
                 if(id[0])
@@ -232,29 +240,33 @@ class IterativeMethod {
             ignore(A, d, i, m, id);
 #endif
         }
-        /* Function: allocate
-         *  Allocates workspace arrays for <Iterative method::CG>. */
-        template<class K, typename std::enable_if<!Wrapper<K>::is_complex>::type* = nullptr>
-        static void allocate(K*& dir, K*& p, const int& n, const unsigned short extra = 0, const unsigned short it = 1, const unsigned short mu = 1) {
-            if(extra == 0) {
-                dir = new K[(3 + std::max(1, 4 * n)) * mu];
-                p = dir + 3 * mu;
-            }
-            else {
-                dir = new K[(3 + 2 * it + std::max(1, (4 + 2 * it) * n)) * mu];
-                p = dir + (3 + 2 * it) * mu;
-            }
+        /* Function: bytes
+         *  Returns the number of bytes, rounded up to a multiple of 16, needed to store n elements of type T in a workspace. */
+        template<class T>
+        static constexpr std::size_t bytes(const std::size_t n) {
+            return ((n * sizeof(T) + 15) / 16) * 16;
         }
-        template<class K, typename std::enable_if<Wrapper<K>::is_complex>::type* = nullptr>
-        static void allocate(underlying_type<K>*& dir, K*& p, const int& n, const unsigned short extra = 0, const unsigned short it = 1, const unsigned short mu = 1) {
-            if(extra == 0) {
-                dir = new underlying_type<K>[3 * mu];
-                p = new K[std::max(1, 4 * n) * mu];
-            }
-            else {
-                dir = new underlying_type<K>[(3 + 2 * it) * mu];
-                p = new K[std::max(1, (4 + 2 * it) * n) * mu];
-            }
+        /* Function: carve
+         *  Returns the next n elements of type T from a workspace and advances the workspace pointer. */
+        template<class T>
+        static T* carve(char*& w, const std::size_t n) {
+            T* const pt = reinterpret_cast<T*>(w);
+            w += bytes<T>(n);
+            return pt;
+        }
+        /* Function: view
+         *  Points a vector, or the array of pointers to the values shared with each neighbor of a Lagrange multiplier, to values carved from a workspace. */
+        template<class Operator, class K>
+        static void view(const Operator&, K*& v, char*& w, const std::size_t n) {
+            v = carve<K>(w, n);
+        }
+        template<class Operator, class K>
+        static void view(const Operator& A, K**& v, char*& w, const std::size_t n) {
+            const auto& map = A.getMap();
+            v = carve<K*>(w, std::max(map.size(), std::size_t(1)));
+            *v = carve<K>(w, n);
+            for(unsigned short i = 1; i < map.size(); ++i)
+                v[i] = v[i - 1] + map[i - 1].second.size();
         }
         /* Function: updateSol
          *
@@ -352,7 +364,7 @@ class IterativeMethod {
         template<bool excluded, class Operator, class K, class T>
         static int updateSolRecycling(const Operator& A, const char variant, const int& n, K* const x, const K* const* const h, K* const s, K* const* const v, T* const norm, const K* const C, const K* const U, const short* const hasConverged, const int shift, const int mu, K* const work, const MPI_Comm& comm, const int& deflated = -1) {
 #if !HPDDM_PETSC
-            const bool same = Option::get()->template val<unsigned short>(A.prefix("recycle_same_system"));
+            const bool same = A.snapshot().recycle_same_system_;
 #else
             const bool same = false;
 #endif
@@ -446,13 +458,36 @@ class IterativeMethod {
             return Blas<T>::dot(n, x, incx, y, incy);
         }
         template<class T, class U, typename std::enable_if<std::is_pointer<T>::value>::type* = nullptr>
-        static void diag(const int&, const U* const* const, T* const, T* const = nullptr) { }
+        static void diag(const int&, const U* const* const, T* const, T* const = nullptr, const int& = 1) { }
         template<class T, typename std::enable_if<!std::is_pointer<T>::value>::type* = nullptr>
-        static void diag(const int& n, const underlying_type<T>* const d, T* const in, T* const out = nullptr) {
+        static void diag(const int& n, const underlying_type<T>* const d, T* const in, T* const out = nullptr, const int& mu = 1) {
             if(out)
-                Wrapper<T>::diag(n, d, in, out);
+                Wrapper<T>::diag(n, d, in, out, mu);
             else
-                Wrapper<T>::diag(n, d, in);
+                Wrapper<T>::diag(n, d, in, mu);
+        }
+        /* Function: weightedDot
+         *  Computes the local contribution to the dot product of two vectors of Lagrange multipliers, or of two vectors weighted by a partition of unity. */
+        template<class K, class U>
+        static K weightedDot(const int& n, const U* const* const, const K* const x, const K* const y) {
+            return Blas<K>::dot(&n, x, &i__1, y, &i__1) / underlying_type<K>(2.0);
+        }
+        template<class K>
+        static K weightedDot(const int& n, const underlying_type<K>* const d, const K* const x, const K* const y) {
+            K sum = K();
+            for(int i = 0; i < n; ++i)
+                sum += d[i] * Wrapper<K>::conj(x[i]) * y[i];
+            return sum;
+        }
+        /* Function: data
+         *  Returns a pointer to the contiguous values of a set of vectors or of Lagrange multipliers. */
+        template<class T, typename std::enable_if<std::is_pointer<T>::value>::type* = nullptr>
+        static T data(T* const pt) {
+            return *pt;
+        }
+        template<class T, typename std::enable_if<!std::is_pointer<T>::value>::type* = nullptr>
+        static T* data(T* const pt) {
+            return pt;
         }
         template<bool excluded, class Operator, class K>
         static int initializeNorm(const Operator& A, const char variant, const K* const b, K* const x, K* const v, const int n, K* work, underlying_type<K>* const norm, const unsigned short mu, const unsigned short k, bool& allocate) {
@@ -491,6 +526,13 @@ class IterativeMethod {
             }
             return 0;
         }
+        /* Function: allreduce
+         *  Sums a buffer of the orthogonalization process over all processes of a communicator, see <Profiler>. */
+        template<class T>
+        static void allreduce(T* const buffer, const int count, const MPI_Comm& comm) {
+            Profiler::Event event(Profiler::ORTHOGONALIZATION, count * sizeof(T));
+            MPI_Allreduce(MPI_IN_PLACE, buffer, count, Wrapper<T>::mpi_type(), Wrapper<T>::mpi_op(MPI_SUM), comm);
+        }
         /* Function: orthogonalization
          *
          *  Orthogonalizes a block of vectors against a contiguous set of block of vectors.
@@ -514,9 +556,9 @@ class IterativeMethod {
                 std::fill_n(H, k * mu, K());
                 if(id == 1)
                     for(unsigned short i = 0; i < k; ++i)
-                        MPI_Allreduce(MPI_IN_PLACE, H + i * mu, mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(H + i * mu, mu, comm);
                 else
-                    MPI_Allreduce(MPI_IN_PLACE, H, k * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                    allreduce(H, k * mu, comm);
             }
             else {
                 if(id == 1) {
@@ -530,7 +572,7 @@ class IterativeMethod {
                         else
                             for(unsigned short nu = 0; nu < mu; ++nu)
                                 H[i * mu + nu] = Blas<K>::dot(&n, B + (i * mu + nu) * n, &i__1, v + nu * n, &i__1);
-                        MPI_Allreduce(MPI_IN_PLACE, H + i * mu, mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(H + i * mu, mu, comm);
                         for(unsigned short nu = 0; nu < mu; ++nu) {
                             K alpha = -H[i * mu + nu];
                             Blas<K>::axpy(&n, &alpha, B + (i * mu + nu) * n, &i__1, v + nu * n, &i__1);
@@ -544,23 +586,104 @@ class IterativeMethod {
                         Wrapper<K>::diag(n, d, v, work, mu);
                     for(unsigned short nu = 0; nu < mu; ++nu)
                         Blas<K>::gemv(&(Wrapper<K>::transc), &n, &k, &(Wrapper<K>::d__1), B + nu * n, &ldb, pt + nu * n, &i__1, &(Wrapper<K>::d__0), H + nu, &mu);
-                    MPI_Allreduce(MPI_IN_PLACE, H, k * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                    allreduce(H, k * mu, comm);
                     for(unsigned short nu = 0; nu < mu; ++nu)
                         Blas<K>::gemv("N", &n, &k, &(Wrapper<K>::d__2), B + nu * n, &ldb, H + nu, &mu, &(Wrapper<K>::d__1), v + nu * n, &i__1);
                 }
             }
         }
+        /* Function: singleReductionOrthogonalization
+         *
+         *  Orthogonalizes a block of vectors against a contiguous set of block of vectors using a classical Gram--Schmidt process with a single global reduction. This reduction gathers the dot products of the input vectors with the basis, their squared norms, and the dot products of the last vectors of the basis with the basis, so that the squared norms of the orthogonalized vectors may be recovered from the Gram matrix of the basis without any additional communication. A second pass is performed only if a severe cancellation is detected.
+         *
+         * Template Parameters:
+         *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
+         *    K              - Scalar type.
+         *
+         * Parameters:
+         *    n              - Size of the vectors to orthogonalize.
+         *    k              - Size of the basis to orthogonalize against.
+         *    mu             - Number of vectors in each block.
+         *    B              - Pointer to the basis.
+         *    v              - Input block of vectors.
+         *    H              - Dot products.
+         *    sn             - Squared norms of the orthogonalized vectors.
+         *    G              - Upper triangular parts of the Gram matrices of the basis, followed by a workspace array of size (2 * k + 1) * mu.
+         *    ldg            - Leading dimension of each Gram matrix.
+         *    comm           - Global MPI communicator. */
+        template<bool excluded, class K>
+        static void singleReductionOrthogonalization(const int n, const int k, const int mu, const K* const B, K* const v, K* const H, underlying_type<K>* const sn, const underlying_type<K>* const d, K* const work, K* const G, const int ldg, const MPI_Comm& comm) {
+            int ldb = mu * n;
+            K* const h = G + mu * ldg * ldg;
+            K* const t = h + (k + 1) * mu;
+            for(unsigned short pass = 0; pass < 2; ++pass) {
+                const int size = (pass == 0 ? 2 * k + 1 : k + 1) * mu;
+                if(excluded || !n)
+                    std::fill_n(h, size, K());
+                else {
+                    const K* pt;
+                    if(pass == 0) {
+                        pt = B + (k - 1) * ldb;
+                        if(d) {
+                            Wrapper<K>::diag(n, d, pt, work, mu);
+                            pt = work;
+                        }
+                        for(unsigned short nu = 0; nu < mu; ++nu)
+                            Blas<K>::gemv(&(Wrapper<K>::transc), &n, &k, &(Wrapper<K>::d__1), B + nu * n, &ldb, pt + nu * n, &i__1, &(Wrapper<K>::d__0), t + nu, &mu);
+                    }
+                    pt = v;
+                    if(d) {
+                        Wrapper<K>::diag(n, d, v, work, mu);
+                        pt = work;
+                    }
+                    for(unsigned short nu = 0; nu < mu; ++nu) {
+                        Blas<K>::gemv(&(Wrapper<K>::transc), &n, &k, &(Wrapper<K>::d__1), B + nu * n, &ldb, pt + nu * n, &i__1, &(Wrapper<K>::d__0), h + nu, &mu);
+                        h[k * mu + nu] = HPDDM::real(Blas<K>::dot(&n, v + nu * n, &i__1, pt + nu * n, &i__1));
+                    }
+                }
+                allreduce(h, size, comm);
+                if(!excluded && n)
+                    for(unsigned short nu = 0; nu < mu; ++nu)
+                        Blas<K>::gemv("N", &n, &k, &(Wrapper<K>::d__2), B + nu * n, &ldb, h + nu, &mu, &(Wrapper<K>::d__1), v + nu * n, &i__1);
+                bool cancellation = false;
+                for(unsigned short nu = 0; nu < mu; ++nu) {
+                    K* const g = G + nu * ldg * ldg;
+                    if(pass == 0)
+                        for(unsigned short i = 0; i < k; ++i)
+                            g[(k - 1) * ldg + i] = t[i * mu + nu];
+                    const underlying_type<K> norm = HPDDM::real(h[k * mu + nu]);
+                    sn[nu] = norm;
+                    for(unsigned short i = 0; i < k; ++i) {
+                        K gh = K();
+                        for(unsigned short j = 0; j < k; ++j)
+                            gh += (i <= j ? g[j * ldg + i] : Wrapper<K>::conj(g[i * ldg + j])) * h[j * mu + nu];
+                        sn[nu] += HPDDM::real(Wrapper<K>::conj(h[i * mu + nu]) * (gh - underlying_type<K>(2.0) * h[i * mu + nu]));
+                    }
+                    if(sn[nu] < norm * std::sqrt(std::numeric_limits<underlying_type<K>>::epsilon()))
+                        cancellation = true;
+                    sn[nu] = std::max(sn[nu], underlying_type<K>());
+                }
+                if(pass == 0)
+                    std::copy_n(h, k * mu, H);
+                else {
+                    const int dim = k * mu;
+                    Blas<K>::axpy(&dim, &(Wrapper<K>::d__1), h, &i__1, H, &i__1);
+                }
+                if(!cancellation)
+                    break;
+            }
+        }
         template<bool excluded, class K>
         static void blockOrthogonalization(const char id, const int n, const int k, const int mu, const K* const B, K* const v, K* const H, const int ldh, const underlying_type<K>* const d, K* const work, const MPI_Comm& comm) {
             if(excluded || !n) {
                 std::fill_n(work, k * mu * mu, K());
                 if(id == 1)
                     for(unsigned short i = 0; i < k; ++i) {
-                        MPI_Allreduce(MPI_IN_PLACE, work, mu * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(work, mu * mu, comm);
                         Wrapper<K>::template omatcopy<'N'>(mu, mu, work, mu, H + mu * i, ldh);
                     }
                 else {
-                    MPI_Allreduce(MPI_IN_PLACE, work, k * mu * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                    allreduce(work, k * mu * mu, comm);
                     Wrapper<K>::template omatcopy<'N'>(mu, k * mu, work, k * mu, H, ldh);
                 }
             }
@@ -571,7 +694,7 @@ class IterativeMethod {
                         if(d)
                             Wrapper<K>::diag(n, d, v, pt, mu);
                         Blas<K>::gemm(&(Wrapper<K>::transc), "N", &mu, &mu, &n, &(Wrapper<K>::d__1), B + i * mu * n, &n, pt, &n, &(Wrapper<K>::d__0), work, &mu);
-                        MPI_Allreduce(MPI_IN_PLACE, work, mu * mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                        allreduce(work, mu * mu, comm);
                         Blas<K>::gemm("N", "N", &n, &mu, &mu, &(Wrapper<K>::d__2), B + i * mu * n, &n, work, &mu, &(Wrapper<K>::d__1), v, &n);
                         Wrapper<K>::template omatcopy<'N'>(mu, mu, work, mu, H + mu * i, ldh);
                     }
@@ -581,7 +704,7 @@ class IterativeMethod {
                         Wrapper<K>::diag(n, d, v, pt, mu);
                     const int tmp = k * mu;
                     Blas<K>::gemm(&(Wrapper<K>::transc), "N", &tmp, &mu, &n, &(Wrapper<K>::d__1), B, &n, pt, &n, &(Wrapper<K>::d__0), work, &tmp);
-                    MPI_Allreduce(MPI_IN_PLACE, work, mu * tmp, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                    allreduce(work, mu * tmp, comm);
                     Blas<K>::gemm("N", "N", &n, &mu, &tmp, &(Wrapper<K>::d__2), B, &n, work, &tmp, &(Wrapper<K>::d__1), v, &n);
                     Wrapper<K>::template omatcopy<'N'>(mu, tmp, work, tmp, H, ldh);
                 }
@@ -615,7 +738,7 @@ class IterativeMethod {
                 }
             else
                 std::fill_n(work, mu * (k * (k + 1)) / 2, K());
-            MPI_Allreduce(MPI_IN_PLACE, work, mu * (k * (k + 1)) / 2, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+            allreduce(work, mu * (k * (k + 1)) / 2, comm);
             for(unsigned short nu = mu; nu-- > 0; )
                 for(unsigned short xi = k; xi > 0; --xi)
                     std::copy_backward(work + nu * (k * (k + 1)) / 2 + (xi * (xi - 1)) / 2, work + nu * (k * (k + 1)) / 2 + (xi * (xi + 1)) / 2, R + nu * k * k + xi * ldr - (ldr - xi));
@@ -695,7 +818,7 @@ class IterativeMethod {
                     else
                         for(unsigned short nu = 0; nu < mu; ++nu)
                             work[xi * (k + 1) * mu + nu] = Blas<K>::dot(&n, Q + xi * ldv + nu * n, &i__1, Q + xi * ldv + nu * n, &i__1);
-                    MPI_Allreduce(MPI_IN_PLACE, work + xi * (k + 1) * mu, mu, Wrapper<K>::mpi_type(), Wrapper<K>::mpi_op(MPI_SUM), comm);
+                    allreduce(work + xi * (k + 1) * mu, mu, comm);
                     for(unsigned short nu = 0; nu < mu; ++nu) {
                         work[xi * (k + 1) * mu + nu] = HPDDM::sqrt(work[xi * (k + 1) * mu + nu]);
                         if(HPDDM::real(work[xi * (k + 1) * mu + nu]) < underlying_type<K>(HPDDM_EPS))
@@ -716,33 +839,10 @@ class IterativeMethod {
             }
             return rank;
         }
-        /* Function: Arnoldi
-         *  Computes one iteration of the Arnoldi method for generating one basis vector of a Krylov space. */
-        template<bool excluded, class K>
-        static void Arnoldi(const char id, const unsigned short m, K* const* const H, K* const* const v, K* const s, underlying_type<K>* const sn, const int n, const int i, const int mu, const underlying_type<K>* const d, K* const work, const MPI_Comm& comm, K* const* const save = nullptr, const unsigned short shift = 0) {
-#if defined(PETSC_PCHPDDM_MAXLEVELS) && defined(PETSC_USE_LOG)
-            PetscCallContinue(PetscLogEventBegin(KSP_GMRESOrthogonalization, nullptr, nullptr, nullptr, nullptr));
-#endif
-            orthogonalization<excluded>(id & 3, n, i + 1 - shift, mu, v[shift], v[i + 1], H[i] + shift * mu, d, work, comm);
-            if(excluded)
-                std::fill_n(sn + i * mu, mu, 0.0);
-            else if(d)
-                for(unsigned short nu = 0; nu < mu; ++nu) {
-                    sn[i * mu + nu] = 0.0;
-                    for(int j = 0; j < n; ++j)
-                        sn[i * mu + nu] += d[j] * HPDDM::norm(v[i + 1][nu * n + j]);
-                }
-            else
-                for(unsigned short nu = 0; nu < mu; ++nu)
-                    sn[i * mu + nu] = HPDDM::real(Blas<K>::dot(&n, v[i + 1] + nu * n, &i__1, v[i + 1] + nu * n, &i__1));
-            MPI_Allreduce(MPI_IN_PLACE, sn + i * mu, mu, Wrapper<K>::mpi_underlying_type(), Wrapper<underlying_type<K>>::mpi_op(MPI_SUM), comm);
-            for(unsigned short nu = 0; nu < mu; ++nu) {
-                H[i][(i + 1) * mu + nu] = HPDDM::sqrt(sn[i * mu + nu]);
-                if(!excluded && i < m - 1)
-                    std::for_each(v[i + 1] + nu * n, v[i + 1] + (nu + 1) * n, [&](K& y) { y /= H[i][(i + 1) * mu + nu]; });
-            }
-            if(save)
-                Wrapper<K>::template omatcopy<'T'>(i + 2 - shift, mu, H[i] + shift * mu, mu, save[i - shift], m + 1);
+        /* Function: GivensRotations
+         *  Applies the previous Givens rotations to a new column of a Hessenberg matrix, and computes the rotation that eliminates its subdiagonal entry. */
+        template<class K>
+        static void GivensRotations(const unsigned short m, K* const* const H, K* const s, underlying_type<K>* const sn, const int i, const int mu, const unsigned short shift = 0) {
             for(unsigned short k = shift; k < i; ++k) {
                 for(unsigned short nu = 0; nu < mu; ++nu) {
                     K gamma = Wrapper<K>::conj(H[k][(m + 1) * nu + k + 1]) * H[i][k * mu + nu] + sn[k * mu + nu] * H[i][(k + 1) * mu + nu];
@@ -761,10 +861,159 @@ class IterativeMethod {
             }
             if(mu > 1)
                 Wrapper<K>::template imatcopy<'T'>(i + 2, mu, H[i], mu, m + 1);
+        }
+        /* Function: Arnoldi
+         *  Computes one iteration of the Arnoldi method for generating one basis vector of a Krylov space. */
+        template<bool excluded, class K>
+        static void Arnoldi(const char id, const unsigned short m, K* const* const H, K* const* const v, K* const s, underlying_type<K>* const sn, const int n, const int i, const int mu, const underlying_type<K>* const d, K* const work, const MPI_Comm& comm, K* const* const save = nullptr, const unsigned short shift = 0, K* const G = nullptr) {
+#if defined(PETSC_PCHPDDM_MAXLEVELS) && defined(PETSC_USE_LOG)
+            PetscCallContinue(PetscLogEventBegin(KSP_GMRESOrthogonalization, nullptr, nullptr, nullptr, nullptr));
+#endif
+            if((id & 3) == HPDDM_ORTHOGONALIZATION_SRCGS && G)
+                singleReductionOrthogonalization<excluded>(n, i + 1 - shift, mu, v[shift], v[i + 1], H[i] + shift * mu, sn + i * mu, d, work, G, m + 1, comm);
+            else {
+                orthogonalization<excluded>(id & 3, n, i + 1 - shift, mu, v[shift], v[i + 1], H[i] + shift * mu, d, work, comm);
+                if(excluded)
+                    std::fill_n(sn + i * mu, mu, 0.0);
+                else if(d)
+                    for(unsigned short nu = 0; nu < mu; ++nu) {
+                        sn[i * mu + nu] = 0.0;
+                        for(int j = 0; j < n; ++j)
+                            sn[i * mu + nu] += d[j] * HPDDM::norm(v[i + 1][nu * n + j]);
+                    }
+                else
+                    for(unsigned short nu = 0; nu < mu; ++nu)
+                        sn[i * mu + nu] = HPDDM::real(Blas<K>::dot(&n, v[i + 1] + nu * n, &i__1, v[i + 1] + nu * n, &i__1));
+                allreduce(sn + i * mu, mu, comm);
+            }
+            for(unsigned short nu = 0; nu < mu; ++nu) {
+                H[i][(i + 1) * mu + nu] = HPDDM::sqrt(sn[i * mu + nu]);
+                if(!excluded && i < m - 1)
+                    std::for_each(v[i + 1] + nu * n, v[i + 1] + (nu + 1) * n, [&](K& y) { y /= H[i][(i + 1) * mu + nu]; });
+            }
+            if(save)
+                Wrapper<K>::template omatcopy<'T'>(i + 2 - shift, mu, H[i] + shift * mu, mu, save[i - shift], m + 1);
+            GivensRotations(m, H, s, sn, i, mu, shift);
 #if defined(PETSC_PCHPDDM_MAXLEVELS) && defined(PETSC_USE_LOG)
             PetscCallContinue(PetscLogEventEnd(KSP_GMRESOrthogonalization, nullptr, nullptr, nullptr, nullptr));
 #endif
         }
+        /* Function: NewtonShifts
+         *
+         *  Computes the shifts of a Newton polynomial basis as the Leja-ordered Ritz values of the leading principal submatrices of the Hessenberg matrices of the first Arnoldi iterations. For real scalar types, only the real parts of the Ritz values are used.
+         *
+         * Parameters:
+         *    m              - Maximum number of Arnoldi iterations.
+         *    save           - Hessenberg matrices, before applying the Givens rotations.
+         *    t              - Number of shifts.
+         *    mu             - Number of Hessenberg matrices.
+         *    theta          - Shifts.
+         *    h              - Workspace array of size t * (t + 3). */
+        template<class K>
+        static bool NewtonShifts(const unsigned short m, const K* const* const save, const int t, const int mu, K* const theta, K* const h) {
+            K* const w = h + t * t;
+            int info = 0;
+            for(unsigned short nu = 0; nu < mu && !info; ++nu) {
+                for(unsigned short i = 0; i < t; ++i)
+                    std::copy_n(save[i] + nu * (m + 1), t, h + i * t);
+                Lapack<K>::hseqr("E", "N", &t, &i__1, &t, h, &t, w, w + t, nullptr, &i__1, w + 2 * t, &t, &info);
+                K* const shift = theta + nu * t;
+                for(unsigned short l = 0; l < t && !info; ++l) {
+                    unsigned short index = 0;
+                    underlying_type<K> max = -1.0;
+                    for(unsigned short j = 0; j < t; ++j) {
+                        underlying_type<K> prod = HPDDM::abs(w[j]);
+                        for(unsigned short q = 0; q < l; ++q)
+                            prod *= HPDDM::abs(w[j] - shift[q]);
+                        if(prod > max) {
+                            max = prod;
+                            index = j;
+                        }
+                    }
+                    shift[l] = w[index];
+                }
+            }
+            return !info;
+        }
+        /* Function: sStepArnoldi
+         *
+         *  Computes t iterations of the Arnoldi method at once, given t vectors of a Newton polynomial basis. These vectors are orthogonalized against the current basis with a single global reduction, and then orthonormalized with a distributed QR decomposition, see <IterativeMethod::QR>. The Hessenberg matrices are eventually recovered from the change of basis, see section 3.3 of Hoemmen's thesis, Communication-avoiding Krylov subspace methods.
+         *
+         * Template Parameters:
+         *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
+         *    K              - Scalar type.
+         *
+         * Parameters:
+         *    id             - Type of QR decomposition.
+         *    m              - Maximum number of Arnoldi iterations.
+         *    H              - Hessenberg matrices.
+         *    v              - Basis, followed by the t vectors of the Newton polynomial basis.
+         *    save           - Hessenberg matrices, before applying the Givens rotations.
+         *    theta          - Shifts of the Newton polynomial basis.
+         *    n              - Size of the vectors.
+         *    i              - Current iteration.
+         *    t              - Number of vectors of the Newton polynomial basis.
+         *    mu             - Number of right-hand sides.
+         *    work           - Workspace array of size mu * t * (n + t).
+         *    P              - Workspace array of size mu * (i + 1 + t) * t + (i + 1 + 2 * t) * t.
+         *    comm           - Global MPI communicator.
+         *
+         * Returns:
+         *    Number of new columns of the Hessenberg matrices, which may be lower than t if the Newton polynomial basis is numerically rank deficient. */
+        template<bool excluded, class K>
+        static unsigned short sStepArnoldi(const char id, const unsigned short m, K* const* const H, K* const* const v, K* const* const save, const K* const theta, const int n, const int i, const int t, const int mu, const underlying_type<K>* const d, K* const work, K* const P, const MPI_Comm& comm) {
+            const int k = i + 1;
+            const int ldv = mu * n;
+            K* const R = P + mu * k * t;
+            K* const M = R + mu * t * t;
+            K* const T = M + (k + t) * t;
+            if(excluded || !n)
+                std::fill_n(P, mu * k * t, K());
+            else {
+                const K* pt = v[k];
+                if(d) {
+                    Wrapper<K>::diag(n, d, v[k], work, t * mu);
+                    pt = work;
+                }
+                for(unsigned short nu = 0; nu < mu; ++nu)
+                    Blas<K>::gemm(&(Wrapper<K>::transc), "N", &k, &t, &n, &(Wrapper<K>::d__1), *v + nu * n, &ldv, pt + nu * n, &ldv, &(Wrapper<K>::d__0), P + nu * k * t, &k);
+            }
+            allreduce(P, mu * k * t, comm);
+            if(!excluded && n)
+                for(unsigned short nu = 0; nu < mu; ++nu)
+                    Blas<K>::gemm("N", "N", &n, &t, &k, &(Wrapper<K>::d__2), *v + nu * n, &ldv, P + nu * k * t, &k, &(Wrapper<K>::d__1), v[k] + nu * n, &ldv);
+            int rank = QR<excluded>((id >> 2) & 7, n, t, v[k], R, t, d, work, comm, true, mu);
+            const int ldm = k + rank;
+            for(unsigned short nu = 0; nu < mu && rank; ++nu) {
+                const K* const p = P + nu * k * t;
+                const K* const r = R + nu * t * t;
+                // coefficients of the Newton polynomial basis in the new orthonormal basis
+                auto coefficient = [&](const int row, const int l) {
+                    if(l == 0)
+                        return row == i ? K(1.0) : K();
+                    else if(row < k)
+                        return p[row + (l - 1) * k];
+                    else
+                        return row - k < l ? r[row - k + (l - 1) * t] : K();
+                };
+                for(unsigned short l = 0; l < rank; ++l) {
+                    for(int row = 0; row < ldm; ++row) {
+                        K val = theta[nu * t + l] * coefficient(row, l) + coefficient(row, l + 1);
+                        if(row <= i)
+                            for(unsigned short c = std::max(row - 1, 0); c < i; ++c)
+                                val -= save[c][nu * (m + 1) + row] * coefficient(c, l);
+                        M[row + l * ldm] = val;
+                    }
+                    for(unsigned short j = 0; j < rank; ++j)
+                        T[j + l * rank] = (j <= l ? coefficient(i + j, l) : K());
+                }
+                Blas<K>::trsm("R", "U", "N", "N", &ldm, &rank, &(Wrapper<K>::d__1), T, &rank, M, &ldm);
+                for(unsigned short c = 0; c < rank; ++c)
+                    for(unsigned short row = 0; row < i + c + 2; ++row)
+                        H[i + c][row * mu + nu] = save[i + c][nu * (m + 1) + row] = M[row + c * ldm];
+            }
+            return rank;
+        }
         /* Function: BlockArnoldi
          *  Computes one iteration of the Block Arnoldi method for generating one basis vector of a block Krylov space. */
         template<bool excluded, class K>
@@ -1044,6 +1293,22 @@ class IterativeMethod {
         template<bool, class Operator, class K>
         static int BFBCG(const Operator&, const K* const, K* const, const int&, const MPI_Comm&);
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
+        /* Function: PIPECG
+         *
+         *  Implements the pipelined CG method of Ghysels and Vanroose, with a single (nonblocking if possible) global reduction per iteration overlapped with the application of the preconditioner and of the operator.
+         *
+         * Template Parameters:
+         *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
+         *    K              - Scalar type.
+         *
+         * Parameters:
+         *    A              - Global operator.
+         *    b              - Right-hand side(s).
+         *    x              - Solution vector(s).
+         *    mu             - Number of right-hand sides.
+         *    comm           - Global MPI communicator. */
+        template<bool, class Operator, class K>
+        static int PIPECG(const Operator& A, const K* const b, K* const x, const int& mu, const MPI_Comm& comm);
         template<bool excluded, class Operator, class K>
         static int Richardson(const Operator& A, const K* const b, K* const x, const int& mu, const MPI_Comm&) {
             K factor;
@@ -1072,7 +1337,7 @@ class IterativeMethod {
 #endif
         /* Function: PCG
          *
-         *  Implements the projected CG method.
+         *  Implements the projected CG method. Each search direction is reorthogonalized against a window of previous ones, see the option -hpddm_substructuring_pcg_window, which are kept in a ring buffer. If the option -hpddm_substructuring_recycled_directions is set, search directions are also kept from one solve to the next, so that subsequent solves with the same operator start from a deflated initial guess and are orthogonalized against them. They are discarded by <Schur::callNumfact>, <Schur::callNumfactPreconditioner>, and <Schur::buildTwo>, and must otherwise be discarded by calling destroy() on the operator whenever it changes.
          *
          * Template Parameters:
          *    excluded       - True if the main processes are excluded from the domain decomposition, false otherwise.
@@ -1080,11 +1345,12 @@ class IterativeMethod {
          *
          * Parameters:
          *    A              - Global operator.
-         *    b              - Right-hand side.
-         *    x              - Solution vector.
+         *    b              - Right-hand side(s).
+         *    x              - Solution vector(s).
+         *    mu             - Number of right-hand sides.
          *    comm           - Global MPI communicator. */
         template<bool excluded = false, class Operator, class K>
-        static int PCG(const Operator& A, const K* const b, K* const x, const MPI_Comm& comm);
+        static int PCG(const Operator& A, const K* const b, K* const x, const int& mu, const MPI_Comm& comm);
 #if !HPDDM_PETSC || defined(PETSC_PCHPDDM_MAXLEVELS)
         template<bool excluded = false, class Operator = void, class K = double, typename std::enable_if<!is_substructuring_method<Operator>::value>::type* = nullptr>
         static
@@ -1144,6 +1410,7 @@ class IterativeMethod {
                                                      break; }
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
                 case HPDDM_KRYLOV_METHOD_RICHARDSON: it = Richardson<excluded>(A, sb, sx, k * mu, comm); break;
+                case HPDDM_KRYLOV_METHOD_PIPECG:     it = PIPECG<excluded>(A, sb, sx, k * mu, comm); break;
 #endif
                 case HPDDM_KRYLOV_METHOD_BFBCG:      it = BFBCG<excluded>(A, sb, sx, k * mu, comm); break;
                 case HPDDM_KRYLOV_METHOD_BGCRODR:    it = BGCRODR<excluded>(A, sb, sx, k * mu, comm); break;
@@ -1172,14 +1439,14 @@ class IterativeMethod {
 #endif
 #if !defined(PETSC_PCHPDDM_MAXLEVELS)
         template<bool excluded = false, class Operator = void, class K = double, typename std::enable_if<is_substructuring_method<Operator>::value>::type* = nullptr>
-        static int solve(const Operator& A, const K* const b, K* const x, const int&, const MPI_Comm& comm) {
+        static int solve(const Operator& A, const K* const b, K* const x, const int& mu, const MPI_Comm& comm) {
             std::ios_base::fmtflags ff(std::cout.flags());
             std::cout << std::scientific;
-            int it = PCG<excluded>(A, b, x, comm);
+            int it = PCG<excluded>(A, b, x, mu, comm);
 #if !HPDDM_PETSC
             unsigned short k = Option::get()->val<unsigned short>(A.prefix() + "compute_residual", 10);
             if(!excluded && k == HPDDM_COMPUTE_RESIDUAL_L2)
-                printResidual(A, b, x, 1, HPDDM_COMPUTE_RESIDUAL_L2, comm);
+                printResidual(A, b, x, mu, HPDDM_COMPUTE_RESIDUAL_L2, comm);
 #endif
             std::cout.flags(ff);
             return it;
@@ -27,6 +27,13 @@
 
 #include <iterator>
 #include <array>
+#include <cstring>
+#if !HPDDM_PETSC && (defined(__unix__) || defined(__APPLE__))
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
 
 namespace HPDDM {
 template<class K>
@@ -172,7 +179,7 @@ class MatrixCSR : public MatrixBase<K> {
                 MatrixBase<K>::ia_ = MatrixBase<K>::ja_ = nullptr;
                 MatrixBase<K>::n_ = MatrixBase<K>::m_ = MatrixBase<K>::nnz_ = 0;
             }
-            else {
+            else if(!read(file)) {
                 std::string line;
                 MatrixBase<K>::n_ = MatrixBase<K>::m_ = MatrixBase<K>::nnz_ = 0;
                 while(MatrixBase<K>::nnz_ == 0 && std::getline(file, line)) {
@@ -282,6 +289,71 @@ class MatrixCSR : public MatrixBase<K> {
         ~MatrixCSR() {
             destroy();
         }
+        /* Function: scalar
+         *  Returns the character identifying the scalar type in files written by <MatrixCSR::save>. */
+        static constexpr char scalar() {
+            return Wrapper<K>::is_complex ? (std::is_same<underlying_type<K>, float>::value ? 'c' : 'z') : (std::is_same<K, float>::value ? 's' : 'd');
+        }
+        /* Function: header
+         *
+         *  Parses the header of a file written by <MatrixCSR::save>, and returns the offset of the array of data, or 0 if the header is invalid.
+         *
+         * Parameters:
+         *    h              - Header.
+         *    info           - Version, number of rows, number of columns, and number of nonzero entries.
+         *    sym            - Symmetry of the matrix.
+         *    N              - 0- or 1-based indexing. */
+        static std::size_t header(const char* const h, int* const info, bool& sym, char& N) {
+            std::memcpy(info, h + 8, 4 * sizeof(int));
+            if(!std::equal(h, h + 8, "HPDDMCSR") || info[0] != 1 || info[1] < 0 || info[2] < 0 || info[3] < 0 || (h[24] != 0 && h[24] != 1) || h[26] != scalar() || (h[25] != 'C' && h[25] != 'F'))
+                return 0;
+            sym = h[24];
+            N = h[25];
+            return ((32 + sizeof(int) * (static_cast<std::size_t>(info[1]) + 1 + static_cast<std::size_t>(info[3])) + 15) / 16) * 16;
+        }
+        /* Function: valid
+         *
+         *  Checks that the arrays of indices of a file written by <MatrixCSR::save> describe a well-formed matrix, i.e., that row offsets are nondecreasing and consistent with the number of nonzero entries, and that column indices are in range.
+         *
+         * Parameters:
+         *    ia             - Array of row offsets.
+         *    ja             - Array of column indices.
+         *    info           - Version, number of rows, number of columns, and number of nonzero entries.
+         *    N              - 0- or 1-based indexing. */
+        static bool valid(const int* const ia, const int* const ja, const int* const info, const char N) {
+            if(ia[0] != (N == 'F') || ia[info[1]] != info[3] + (N == 'F'))
+                return false;
+            for(int i = 0; i < info[1]; ++i)
+                if(ia[i + 1] < ia[i])
+                    return false;
+            return std::all_of(ja, ja + info[3], [&](int j) { return j >= (N == 'F') && j < info[2] + (N == 'F'); });
+        }
+#if !HPDDM_PETSC
+        /* Function: save
+         *
+         *  Outputs the matrix to a binary stream: a 32-byte header (magic string, version, number of rows, number of columns, number of nonzero entries, symmetry, numbering, and scalar type), <MatrixBase::ia>, <MatrixBase::ja>, and <MatrixCSR::a>, aligned on 16 bytes. Such a stream may be read by the std::ifstream constructor, or a file mapped into memory with <MatrixMap>. */
+        std::ostream& save(std::ostream& f) const {
+            char h[32] = { };
+            std::copy_n("HPDDMCSR", 8, h);
+            const int info[4] = { 1, MatrixBase<K>::n_, MatrixBase<K>::m_, MatrixBase<K>::nnz_ };
+            std::memcpy(h + 8, info, sizeof(info));
+            h[24] = MatrixBase<K>::sym_;
+            h[25] = (MatrixBase<K>::ia_ && MatrixBase<K>::ia_[MatrixBase<K>::n_] == MatrixBase<K>::nnz_ + 1 ? 'F' : 'C');
+            h[26] = scalar();
+            f.write(h, 32);
+            if(MatrixBase<K>::ia_) {
+                int parsed[4];
+                bool sym;
+                char N;
+                const char pad[16] = { };
+                f.write(reinterpret_cast<const char*>(MatrixBase<K>::ia_), sizeof(int) * (static_cast<std::size_t>(MatrixBase<K>::n_) + 1));
+                f.write(reinterpret_cast<const char*>(MatrixBase<K>::ja_), sizeof(int) * static_cast<std::size_t>(MatrixBase<K>::nnz_));
+                f.write(pad, header(h, parsed, sym, N) - 32 - sizeof(int) * (static_cast<std::size_t>(MatrixBase<K>::n_) + 1 + static_cast<std::size_t>(MatrixBase<K>::nnz_)));
+                f.write(reinterpret_cast<const char*>(a_), sizeof(K) * static_cast<std::size_t>(MatrixBase<K>::nnz_));
+            }
+            return f;
+        }
+#endif
         /* Function: destroy
          *  Destroys the pointer <MatrixCSR::a> using a custom deallocator if <MatrixCSR::free> is true. */
         void destroy(void (*dtor)(void*) = ::operator delete[]) {
@@ -400,6 +472,63 @@ class MatrixCSR : public MatrixBase<K> {
         constexpr bool getFree() const {
             return MatrixBase<K>::free_;
         }
+#if !HPDDM_PETSC
+    private:
+        /* Function: read
+         *  Reads a matrix written by <MatrixCSR::save>, and returns false without consuming the stream if it does not start with the expected magic string. */
+        bool read(std::istream& file) {
+            char h[32];
+            if(!file.read(h, 32) || !std::equal(h, h + 8, "HPDDMCSR")) {
+                file.clear();
+                file.seekg(0);
+                return false;
+            }
+            int info[4];
+            bool sym = false;
+            char N = HPDDM_NUMBERING;
+            const std::size_t offset = header(h, info, sym, N);
+            a_ = nullptr;
+            MatrixBase<K>::ia_ = MatrixBase<K>::ja_ = nullptr;
+            MatrixBase<K>::n_ = MatrixBase<K>::m_ = MatrixBase<K>::nnz_ = 0;
+            MatrixBase<K>::free_ = true;
+            const std::streampos begin = file.tellg();
+            std::streamoff remaining = -1;
+            if(begin != std::streampos(-1) && file.seekg(0, std::ios::end)) {
+                remaining = file.tellg() - begin;
+                file.seekg(begin);
+            }
+            file.clear();
+            if(offset && info[1] && info[2] && (remaining == -1 || static_cast<std::size_t>(remaining) >= offset - 32 + sizeof(K) * static_cast<std::size_t>(info[3]))) {
+                MatrixBase<K>::ia_ = new int[info[1] + 1];
+                MatrixBase<K>::ja_ = new int[info[3]];
+                a_ = new K[info[3]];
+                file.read(reinterpret_cast<char*>(MatrixBase<K>::ia_), sizeof(int) * (static_cast<std::size_t>(info[1]) + 1));
+                file.read(reinterpret_cast<char*>(MatrixBase<K>::ja_), sizeof(int) * static_cast<std::size_t>(info[3]));
+                file.ignore(offset - 32 - sizeof(int) * (static_cast<std::size_t>(info[1]) + 1 + static_cast<std::size_t>(info[3])));
+                file.read(reinterpret_cast<char*>(a_), sizeof(K) * static_cast<std::size_t>(info[3]));
+                if(!file || !valid(MatrixBase<K>::ia_, MatrixBase<K>::ja_, info, N)) {
+                    delete [] a_;
+                    a_ = nullptr;
+                    delete [] MatrixBase<K>::ja_;
+                    delete [] MatrixBase<K>::ia_;
+                    MatrixBase<K>::ia_ = MatrixBase<K>::ja_ = nullptr;
+                }
+                else {
+                    MatrixBase<K>::n_ = info[1];
+                    MatrixBase<K>::m_ = info[2];
+                    MatrixBase<K>::nnz_ = info[3];
+                    MatrixBase<K>::sym_ = sym;
+                    if(N != HPDDM_NUMBERING) {
+                        const int shift = (HPDDM_NUMBERING == 'F' ? 1 : -1);
+                        std::for_each(MatrixBase<K>::ia_, MatrixBase<K>::ia_ + info[1] + 1, [&](int& i) { i += shift; });
+                        std::for_each(MatrixBase<K>::ja_, MatrixBase<K>::ja_ + info[3], [&](int& i) { i += shift; });
+                    }
+                }
+            }
+            return true;
+        }
+    public:
+#endif
         template<char N>
         std::ostream& dump(std::ostream& f) const {
             return MatrixBase<K>::template dump<N>(f, a_);
@@ -417,5 +546,201 @@ inline std::ostream& operator <<(std::ostream& f, const MatrixCSR<K>& m) {
         return m.template dump<'F'>(f);
     return f << "Malformed CSR matrix" << std::endl;
 }
+#if !HPDDM_PETSC && (defined(__unix__) || defined(__APPLE__))
+/* Class: MatrixMap
+ *
+ *  A class for mapping into memory a file written by <MatrixCSR::save>. The arrays of <MatrixMap::A> point inside the mapping, which remains valid until the MatrixMap is destroyed. Pages are mapped privately, so that modifications are never written back to the file, and they are only copied if the numbering of the file differs from HPDDM_NUMBERING.
+ *
+ * Template Parameter:
+ *    K              - Scalar type. */
+template<class K>
+class MatrixMap {
+    private:
+        /* Variable: addr
+         *  Address of the mapping. */
+        void*       addr_;
+        /* Variable: size
+         *  Size of the mapping. */
+        std::size_t size_;
+    public:
+        /* Variable: A
+         *  Matrix which does not own its arrays, empty if the file could not be mapped or read. */
+        MatrixCSR<K>*  A_;
+        explicit MatrixMap(const std::string& filename) : addr_(), size_(), A_() {
+            const int fd = open(filename.c_str(), O_RDONLY);
+            if(fd != -1) {
+                struct stat st;
+                if(fstat(fd, &st) == 0 && st.st_size >= 32) {
+                    size_ = st.st_size;
+                    addr_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                    if(addr_ == MAP_FAILED)
+                        addr_ = nullptr;
+                }
+                close(fd);
+            }
+            int info[4];
+            bool sym;
+            char N;
+            char* const h = static_cast<char*>(addr_);
+            const std::size_t offset = (addr_ ? MatrixCSR<K>::header(h, info, sym, N) : 0);
+            int* const ia = reinterpret_cast<int*>(h + 32);
+            if(offset && info[1] && info[2] && offset <= size_ && sizeof(K) * static_cast<std::size_t>(info[3]) <= size_ - offset && MatrixCSR<K>::valid(ia, ia + info[1] + 1, info, N)) {
+                int* const ja = ia + info[1] + 1;
+                if(N != HPDDM_NUMBERING) {
+                    const int shift = (HPDDM_NUMBERING == 'F' ? 1 : -1);
+                    std::for_each(ia, ja + info[3], [&](int& i) { i += shift; });
+                }
+                A_ = new MatrixCSR<K>(info[1], info[2], info[3], reinterpret_cast<K*>(h + offset), ia, ja, sym);
+            }
+            else
+                A_ = new MatrixCSR<K>();
+        }
+        MatrixMap(const MatrixMap&) = delete;
+        ~MatrixMap() {
+            delete A_;
+            if(addr_)
+                munmap(addr_, size_);
+        }
+};
+#endif
+/* Class: MatrixSELL
+ *
+ *  A class for storing sparse matrices in the sliced ELLPACK format SELL-C-sigma, used for matrix-vector products. Rows are sorted by decreasing number of nonzero entries within windows of sigma rows, and then grouped in chunks of C rows, padded to the same length and stored column-major.
+ *
+ * Template Parameter:
+ *    K              - Scalar type. */
+template<class K>
+class MatrixSELL {
+    public:
+        /* Variable: a
+         *  Array of data, padded with zeros. */
+        K*             a_;
+        /* Variable: ja
+         *  Array of 0-based column indices. */
+        int*          ja_;
+        /* Variable: cs
+         *  Offsets of the chunks in <MatrixSELL::a> and <MatrixSELL::ja>. */
+        int*          cs_;
+        /* Variable: perm
+         *  Original indices of the sorted rows. */
+        int*        perm_;
+        /* Variable: n
+         *  Number of rows. */
+        int            n_;
+        /* Variable: c
+         *  Number of rows per chunk. */
+        unsigned short c_;
+        /* Function: MatrixSELL
+         *
+         *  Builds a SELL-C-sigma copy of a <MatrixCSR>. Symmetric matrices are expanded, so that both triangular parts are stored.
+         *
+         * Parameters:
+         *    A              - Input matrix.
+         *    c              - Number of rows per chunk, rounded up to 4, 8, 16, or 32.
+         *    sigma          - Number of rows of the sorting windows, rounded up to a multiple of the number of rows per chunk.
+         *    order          - Permutation applied to the rows before sorting, or nullptr.
+         *    boundary       - Sorting windows do not cross this row of the permuted matrix. */
+        MatrixSELL(const MatrixCSR<K>* const A, const unsigned short c, const int sigma, const int* const order = nullptr, const int boundary = 0) : n_(A->n_), c_(c <= 4 ? 4 : c <= 8 ? 8 : c <= 16 ? 16 : 32) {
+            const int shift = (A->ia_[n_] == A->nnz_ ? 0 : 1);
+            std::vector<int> length(n_);
+            for(int i = 0; i < n_; ++i) {
+                length[i] += A->ia_[i + 1] - A->ia_[i];
+                if(A->sym_)
+                    for(int j = A->ia_[i] - shift; j < A->ia_[i + 1] - shift; ++j)
+                        if(A->ja_[j] - shift != i)
+                            ++length[A->ja_[j] - shift];
+            }
+            perm_ = new int[n_];
+            if(order)
+                std::copy_n(order, n_, perm_);
+            else
+                std::iota(perm_, perm_ + n_, 0);
+            const int window = std::max(1, (sigma + c_ - 1) / c_) * c_;
+            for(int begin = 0, end = (boundary > 0 && boundary < n_ ? boundary : n_); begin < n_; begin = end, end = n_)
+                for(int i = begin; i < end; i += window)
+                    std::stable_sort(perm_ + i, perm_ + std::min(i + window, end), [&](int lhs, int rhs) { return length[lhs] > length[rhs]; });
+            const int chunks = (n_ + c_ - 1) / c_;
+            cs_ = new int[chunks + 1];
+            cs_[0] = 0;
+            for(int i = 0; i < chunks; ++i) {
+                int width = 0;
+                for(int j = i * c_; j < std::min((i + 1) * c_, n_); ++j)
+                    width = std::max(width, length[perm_[j]]);
+                cs_[i + 1] = cs_[i] + width * c_;
+            }
+            a_ = new K[cs_[chunks]]();
+            ja_ = new int[cs_[chunks]]();
+            std::vector<int> position(n_);
+            for(int i = 0; i < n_; ++i)
+                position[perm_[i]] = i;
+            std::fill(length.begin(), length.end(), 0);
+            auto insert = [&](const int i, const int j, const K& v) {
+                const int k = cs_[position[i] / c_] + length[i]++ * c_ + position[i] % c_;
+                ja_[k] = j;
+                a_[k] = v;
+            };
+            for(int i = 0; i < n_; ++i)
+                for(int j = A->ia_[i] - shift; j < A->ia_[i + 1] - shift; ++j) {
+                    insert(i, A->ja_[j] - shift, A->a_[j]);
+                    if(A->sym_ && A->ja_[j] - shift != i)
+                        insert(A->ja_[j] - shift, i, A->a_[j]);
+                }
+        }
+        MatrixSELL(const MatrixSELL&) = delete;
+        ~MatrixSELL() {
+            delete [] a_;
+            delete [] ja_;
+            delete [] cs_;
+            delete [] perm_;
+        }
+        /* Function: chunks
+         *  Returns the number of chunks needed to store a given number of leading sorted rows. */
+        int chunks(const int rows) const {
+            return (rows + c_ - 1) / c_;
+        }
+        /* Function: multiply
+         *
+         *  Computes the product of a range of chunks with multiple vectors, optionally followed by a diagonal scaling.
+         *
+         * Parameters:
+         *    in             - Input vectors.
+         *    out            - Output vectors.
+         *    mu             - Number of vectors.
+         *    d              - Diagonal scaling, or nullptr.
+         *    first          - First chunk.
+         *    last           - Past-the-last chunk. */
+        void multiply(const K* const in, K* const out, const int& mu, const underlying_type<K>* const d, const int first, const int last) const {
+            switch(c_) {
+                case 4:  multiply<4>(in, out, mu, d, first, last); break;
+                case 8:  multiply<8>(in, out, mu, d, first, last); break;
+                case 16: multiply<16>(in, out, mu, d, first, last); break;
+                default: multiply<32>(in, out, mu, d, first, last);
+            }
+        }
+    private:
+        template<unsigned short C>
+        void multiply(const K* const in, K* const out, const int& mu, const underlying_type<K>* const d, const int first, const int last) const {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if((last - first) * C > HPDDM_GRANULARITY)
+#endif
+            for(int i = first; i < last; ++i) {
+                const int width = (cs_[i + 1] - cs_[i]) / C;
+                for(int nu = 0; nu < mu; ++nu) {
+                    const K* const x = in + nu * n_;
+                    K acc[C] = { };
+                    for(int j = 0; j < width; ++j) {
+                        const K* const a = a_ + cs_[i] + j * C;
+                        const int* const ja = ja_ + cs_[i] + j * C;
+                        for(unsigned short k = 0; k < C; ++k)
+                            acc[k] += a[k] * x[ja[k]];
+                    }
+                    for(unsigned short k = 0; k < C && i * C + k < n_; ++k) {
+                        const int row = perm_[i * C + k];
+                        out[row + nu * n_] = (d ? d[row] * acc[k] : acc[k]);
+                    }
+                }
+            }
+        }
+};
 } // HPDDM
 #endif // HPDDM_MATRIX_HPP_
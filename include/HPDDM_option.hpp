@@ -31,6 +31,8 @@
 #include <cstring>
 #include <stdexcept>
 #include <stack>
+#include <atomic>
+#include <mutex>
 #ifndef HPDDM_NO_REGEX
 #include <regex>
 #endif
@@ -128,8 +130,16 @@ class Option : private Singleton {
          *    key            - Key to remove from <Option::opt>. */
         void remove(const std::string& key) {
             std::unordered_map<std::string, double>::const_iterator it = opt_.find(prefix_ + key);
-            if(it != opt_.cend())
+            if(it != opt_.cend()) {
                 opt_.erase(it);
+                ++revision();
+            }
+        }
+        /* Function: revision
+         *  Returns a counter incremented each time an option may have been modified, see <OptionsPrefix::snapshot>. */
+        static std::atomic<std::size_t>& revision() {
+            static std::atomic<std::size_t> r(0);
+            return r;
         }
         /* Function: val
          *  Returns the value of the key given as an argument, or use a default value if the key is not in <Option::opt>. */
@@ -150,7 +160,10 @@ class Option : private Singleton {
                 return opt_.cbegin()->second;
             }
         }
-        double& operator[](const std::string& key) { return opt_[prefix_ + key]; }
+        double& operator[](const std::string& key) {
+            ++revision();
+            return opt_[prefix_ + key];
+        }
         struct Arg {
             static bool positive(const std::string& opt, const std::string& s, bool verbose) {
                 if(!s.empty()) {
@@ -309,6 +322,7 @@ class Option : private Singleton {
                 }
             });
             if(it != option.end()) {
+                ++revision();
                 std::unordered_map<std::string, double>& map = (internal ? opt_ : *app_);
                 const bool boolean = (std::get<0>(*it).size() > 6 && std::get<0>(*it).substr(std::get<0>(*it).size() - 6) == "=(0|1)");
                 const bool optional = std::get<0>(*it).find("(=") != std::string::npos;
@@ -429,6 +443,7 @@ class Option : private Singleton {
         }
         void setPrefix(const std::string& pre) {
             prefix_ = pre;
+            ++revision();
         }
         std::string getPrefix() const {
             return prefix_;
@@ -439,19 +454,58 @@ template<class K>
 class OptionsPrefix {
     private:
         K* storage_;
+        /* Variable: workspace
+         *  Scratch buffers reused across solves, slot 0 for iterative methods, slot 1 for preconditioners. */
+        mutable void* workspace_[2];
+        /* Variable: capacity
+         *  Sizes in bytes of the scratch buffers. */
+        mutable std::size_t capacity_[2];
 #if !HPDDM_PETSC
+    public:
+        /* Struct: Snapshot
+         *  Typed values of the options read by iterative methods and preconditioners at each iteration, see <OptionsPrefix::snapshot>. */
+        struct Snapshot {
+            double                           tol_;
+            double                 deflation_tol_;
+            double     richardson_damping_factor_;
+            int                          recycle_;
+            short                         max_it_;
+            unsigned short         gmres_restart_;
+            unsigned short          gmres_s_step_;
+            unsigned short enlarge_krylov_subspace_;
+            unsigned short   recycle_same_system_;
+            unsigned short            pcg_window_;
+            unsigned short           pcg_recycle_;
+            char                       verbosity_;
+            char               orthogonalization_;
+            char                              qr_;
+            char                         variant_;
+            char                  recycle_target_;
+            char                recycle_strategy_;
+            char                   krylov_method_;
+            char       schwarz_coarse_correction_;
+        };
+    private:
+        mutable Snapshot snapshot_;
+        /* Variable: revision
+         *  Value of <Option::revision> when <OptionsPrefix::snapshot> was last resolved. */
+        mutable std::atomic<std::size_t> revision_;
     protected:
         char* prefix_;
 #endif
     public:
-        OptionsPrefix() : storage_()
+        OptionsPrefix() : storage_(), workspace_(), capacity_()
 #if !HPDDM_PETSC
-                                    , prefix_()
+                                    , snapshot_(), revision_(std::numeric_limits<std::size_t>::max()), prefix_()
 #endif
                                                 { }
         ~OptionsPrefix() {
             delete [] storage_;
             storage_ = nullptr;
+            for(unsigned short i = 0; i < 2; ++i) {
+                ::operator delete(workspace_[i]);
+                workspace_[i] = nullptr;
+            }
 #if !HPDDM_PETSC
             delete [] prefix_;
             prefix_ = nullptr;
@@ -463,6 +517,7 @@ class OptionsPrefix {
             delete [] prefix_;
             prefix_ = new char[std::strlen(prefix) + 1];
             std::strcpy(prefix_, prefix);
+            revision_ = std::numeric_limits<std::size_t>::max();
         }
         void setPrefix(const std::string& prefix) {
             if(prefix.size())
@@ -474,6 +529,41 @@ class OptionsPrefix {
         std::string prefix(const std::string& opt) const {
             return !prefix_ ? opt : std::string(prefix_) + opt;
         }
+        /* Function: snapshot
+         *
+         *  Returns the options associated to the prefix of the operator. They are looked up in <Option> only if an option has been modified since the last call, so that no string is hashed or allocated inside iterative methods and preconditioners. Threads resolving a stale snapshot concurrently are serialized, but <Option> itself must not be modified while other threads solve. */
+        const Snapshot& snapshot() const {
+            const std::size_t revision = Option::revision().load();
+            if(revision_.load(std::memory_order_acquire) == revision)
+                return snapshot_;
+            static std::mutex mutex;
+            std::lock_guard<std::mutex> lock(mutex);
+            if(revision_.load(std::memory_order_relaxed) != revision) {
+                const std::string prefix = OptionsPrefix::prefix();
+                const Option& opt = *Option::get();
+                snapshot_.tol_ = opt.val(prefix + "tol", 1.0e-6);
+                snapshot_.deflation_tol_ = opt.val(prefix + "deflation_tol", -1.0);
+                snapshot_.richardson_damping_factor_ = opt.val(prefix + "richardson_damping_factor", 1.0);
+                snapshot_.recycle_ = opt.val<int>(prefix + "recycle", 0);
+                snapshot_.max_it_ = opt.val<short>(prefix + "max_it", 100);
+                snapshot_.gmres_restart_ = opt.val<unsigned short>(prefix + "gmres_restart", 40);
+                snapshot_.gmres_s_step_ = opt.val<unsigned short>(prefix + "gmres_s_step", 1);
+                snapshot_.enlarge_krylov_subspace_ = opt.val<unsigned short>(prefix + "enlarge_krylov_subspace", 1);
+                snapshot_.recycle_same_system_ = opt.val<unsigned short>(prefix + "recycle_same_system");
+                snapshot_.pcg_window_ = opt.val<unsigned short>(prefix + "substructuring_pcg_window", 0);
+                snapshot_.pcg_recycle_ = opt.val<unsigned short>(prefix + "substructuring_recycled_directions", 0);
+                snapshot_.verbosity_ = opt.val<char>(prefix + "verbosity", 0);
+                snapshot_.orthogonalization_ = opt.val<char>(prefix + "orthogonalization", HPDDM_ORTHOGONALIZATION_CGS);
+                snapshot_.qr_ = opt.val<char>(prefix + "qr", HPDDM_QR_CHOLQR);
+                snapshot_.variant_ = opt.val<char>(prefix + "variant", HPDDM_VARIANT_RIGHT);
+                snapshot_.recycle_target_ = opt.val<char>(prefix + "recycle_target", HPDDM_RECYCLE_TARGET_SM);
+                snapshot_.recycle_strategy_ = opt.val<char>(prefix + "recycle_strategy", HPDDM_RECYCLE_STRATEGY_A);
+                snapshot_.krylov_method_ = opt.val<char>(prefix + "krylov_method");
+                snapshot_.schwarz_coarse_correction_ = opt.val<char>(prefix + "schwarz_coarse_correction", -1);
+                revision_.store(revision, std::memory_order_release);
+            }
+            return snapshot_;
+        }
 #else
         std::string prefix() const {
             return "";
@@ -503,6 +593,30 @@ class OptionsPrefix {
             pt[1] = k;
             return storage_ + 1 + ((2 * sizeof(unsigned short) - 1) / sizeof(K));
         }
+        /* Function: workspace
+         *
+         *  Returns a scratch buffer of at least n elements, only reallocated when it is too small.
+         *
+         * Template Parameters:
+         *    T              - Element type.
+         *    i              - Slot, 0 for iterative methods, 1 for preconditioners.
+         *
+         * Parameter:
+         *    n              - Number of elements. */
+        template<class T, unsigned short i = 0>
+        T* workspace(std::size_t n) const {
+            static_assert(i < 2, "Wrong workspace slot");
+            n = std::max(n, std::size_t(1)) * sizeof(T);
+            if(n > capacity_[i]) {
+                n = std::max(n, capacity_[i] + capacity_[i] / 2);
+                ::operator delete(workspace_[i]);
+                workspace_[i] = nullptr;
+                capacity_[i] = 0;
+                workspace_[i] = ::operator new(n);
+                capacity_[i] = n;
+            }
+            return static_cast<T*>(workspace_[i]);
+        }
         K* storage() const {
             return storage_ ? storage_ + 1 + ((2 * sizeof(unsigned short) - 1) / sizeof(K)) : nullptr;
         }
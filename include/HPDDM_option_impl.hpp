@@ -51,7 +51,7 @@ inline int Option::parse(std::vector<std::string>& args, bool display, const Con
         std::forward_as_tuple("push_prefix", "Prepend the according prefix for all following options (use -" + std::string(HPDDM_PREFIX) + "pop_prefix when done)", Arg::anything),
         std::forward_as_tuple("reuse_preconditioner=(0|1)", "Do not factorize again the local matrices when solving subsequent systems", Arg::argument),
         std::forward_as_tuple("operator_spd=(0|1)", "Assume the operator is symmetric positive definite", Arg::argument),
-        std::forward_as_tuple("orthogonalization=(cgs|mgs)", "Classical (faster) or Modified (more robust) Gram--Schmidt process", Arg::argument),
+        std::forward_as_tuple("orthogonalization=(cgs|mgs|srcgs)", "Classical (faster), Modified (more robust), or single-reduction Classical Gram--Schmidt process", Arg::argument),
 #ifndef HPDDM_NO_REGEX
         std::forward_as_tuple("dump_matri(ces|x_[[:digit:]]+)=<output_file>", "Save either one or all local matrices to disk", Arg::argument),
 #if defined(EIGENSOLVER) || HPDDM_FETI || HPDDM_BDD
@@ -63,9 +63,13 @@ inline int Option::parse(std::vector<std::string>& args, bool display, const Con
         std::forward_as_tuple("dump_eigenvectors=<output_file>", "Save all local eigenvectors to disk", Arg::argument),
 #endif
 #endif
-        std::forward_as_tuple("krylov_method=(gmres|bgmres|cg|bcg|gcrodr|bgcrodr|bfbcg|richardson|none)", "(Block) Generalized Minimal Residual Method, (Breakdown-Free Block) Conjugate Gradient, (Block) Generalized Conjugate Residual Method With Inner Orthogonalization and Deflated Restarting, or Richardson iterations", Arg::argument),
+        std::forward_as_tuple("dump_binary=(0|1)", "Save local matrices in a binary format, which can be mapped into memory", Arg::argument),
+        std::forward_as_tuple("profiling=(0|1)", "Record the time spent in, the number of calls to, and the volume of communication of the main phases on each process", Arg::argument),
+        std::forward_as_tuple("profiling_output=<output_file>", "Save the minimum, average, and maximum values over all processes of the recorded counters in JSON or CSV format", Arg::argument),
+        std::forward_as_tuple("krylov_method=(gmres|bgmres|cg|bcg|gcrodr|bgcrodr|bfbcg|richardson|none|pipecg)", "(Block) Generalized Minimal Residual Method, (Breakdown-Free Block or Pipelined) Conjugate Gradient, (Block) Generalized Conjugate Residual Method With Inner Orthogonalization and Deflated Restarting, or Richardson iterations", Arg::argument),
         std::forward_as_tuple("enlarge_krylov_subspace=<val>", "Split the initial right-hand side into multiple vectors", Arg::positive),
         std::forward_as_tuple("gmres_restart=<40>", "Maximum number of Arnoldi vectors generated per cycle", Arg::positive),
+        std::forward_as_tuple("gmres_s_step=<1>", "Number of Arnoldi vectors generated with a Newton polynomial before each block orthogonalization", Arg::positive),
         std::forward_as_tuple("variant=(left|right|flexible)", "Left, right, or variable preconditioning", Arg::argument),
         std::forward_as_tuple("qr=(cholqr|cgs|mgs)", "Distributed QR factorizations computed with Cholesky QR, Classical or Modified Gram--Schmidt process", Arg::argument),
         std::forward_as_tuple("deflation_tol=<val>", "Tolerance when deflating right-hand sides inside block methods", Arg::numeric),
@@ -78,10 +82,18 @@ inline int Option::parse(std::vector<std::string>& args, bool display, const Con
         std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n Overlapping Schwarz methods options:"; return true; }),
         std::forward_as_tuple("schwarz_method=(ras|oras|soras|asm|osm|none)", "Symmetric or not, Optimized or Additive, Restricted or not", Arg::argument),
         std::forward_as_tuple("schwarz_coarse_correction=(deflated|additive|balanced)", "Switch to a multilevel preconditioner", Arg::argument),
+        std::forward_as_tuple("schwarz_sell_chunk=<0>", "Number of rows per chunk of a SELL-C-sigma copy of the local matrix used for matrix-vector products (0 to use the CSR matrix)", Arg::integer),
+        std::forward_as_tuple("schwarz_sell_sigma=<1>", "Number of rows of the windows in which rows are sorted by length in the SELL-C-sigma copy", Arg::positive),
+        std::forward_as_tuple("schwarz_mixed_precision=(0|1)", "Factorize the local matrices in single precision", Arg::argument),
+        std::forward_as_tuple("schwarz_refinement_steps=<0>", "Number of steps of iterative refinement after each single-precision local solve", Arg::integer),
 #endif
 #if HPDDM_FETI || HPDDM_BDD
         std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n Substructuring methods options:"; return true; }),
         std::forward_as_tuple("substructuring_scaling=(multiplicity|stiffness|coefficient)", "Type of scaling used for the preconditioner", Arg::argument),
+        std::forward_as_tuple("substructuring_pcg_window=<0>", "Number of previous search directions against which new ones are reorthogonalized in PCG (0 for all of them, 1 for the standard short recurrence)", Arg::integer),
+        std::forward_as_tuple("substructuring_recycled_directions=<0>", "Maximum number of search directions kept from one PCG solve to the next with the same operator", Arg::integer),
+        std::forward_as_tuple("substructuring_schur_complement=(auto|implicit|explicit)", "Application of the local Schur complements, explicit ones are formed after the factorization of the interior matrices", Arg::argument),
+        std::forward_as_tuple("substructuring_schur_applications=<max_it>", "Expected number of applications of the local Schur complements used to choose between implicit and explicit ones", Arg::integer),
 #endif
 #if defined(EIGENSOLVER) || HPDDM_FETI || HPDDM_BDD
         std::forward_as_tuple("eigensolver_tol=<1.0e-6>", "Tolerance for computing eigenvectors by ARPACK or LAPACK", Arg::numeric),
@@ -92,11 +104,22 @@ inline int Option::parse(std::vector<std::string>& args, bool display, const Con
         std::forward_as_tuple("geneo_estimate_nu=(0|1)", "Estimate the number of eigenvalues below a threshold using the inertia of the stencil", Arg::argument),
 #endif
         std::forward_as_tuple("geneo_force_uniformity=(min|max)", "Ensure that the number of local eigenvectors is the same for all subdomains", Arg::argument),
+        std::forward_as_tuple("geneo_warm_start=(0|1)", "Use the previous local eigenvectors as the initial subspace of the eigensolver", Arg::argument),
+        std::forward_as_tuple("geneo_reuse_tol=<val>", "Keep the previous local eigenvectors if their relative residuals are below this tolerance", Arg::numeric),
 #endif
 #ifdef MU_ARPACK
         std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n ARPACK-specific options:"; return true; }),
         std::forward_as_tuple("arpack_ncv=<val>", "Number of Lanczos basis vectors generated in one iteration", Arg::integer),
 #endif
+#ifdef MU_LOBPCG
+        std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n LOBPCG-specific options:"; return true; }),
+        std::forward_as_tuple("lobpcg_max_it=<100>", "Maximum number of LOBPCG iterations", Arg::integer),
+#endif
+#ifdef MU_RANDOMIZED
+        std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n Randomized eigensolver-specific options:"; return true; }),
+        std::forward_as_tuple("randomized_oversampling=<10>", "Number of additional random vectors", Arg::integer),
+        std::forward_as_tuple("randomized_power_it=<2>", "Number of power iterations", Arg::integer),
+#endif
 #if defined(SUBDOMAIN) || defined(COARSEOPERATOR)
 #ifndef HPDDM_NO_REGEX
 #if defined(DMKL_PARDISO) || defined(MKL_PARDISOSUB)
@@ -127,6 +150,10 @@ inline int Option::parse(std::vector<std::string>& args, bool display, const Con
         std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n Dissection-specific options:"; return true; }),
         std::forward_as_tuple("dissection_pivot_tol=<val>", "Tolerance for choosing when to pivot during numerical factorizations", Arg::numeric),
         std::forward_as_tuple("dissection_kkt_scaling=(0|1)", "Turn on KKT scaling instead of the default diagonal scaling", Arg::argument),
+#endif
+#ifdef ILUSUB
+        std::forward_as_tuple("", "", [](std::string&, const std::string&, bool) { std::cout << "\n ILU-specific options:"; return true; }),
+        std::forward_as_tuple("ilu_fill_level=<0>", "Level of fill of the incomplete factorizations of the local matrices", Arg::integer),
 #endif
         std::forward_as_tuple("", "", Arg::anything),
 #if !defined(DSUITESPARSE) && !defined(DLAPACK)
@@ -140,7 +167,7 @@ inline int Option::parse(std::vector<std::string>& args, bool display, const Con
 #endif
             std::string("2)"), "Distribution of the main processes", Arg::integer),
 #endif
-        std::forward_as_tuple(std::string(HPDDM_REGEX_LEVEL) + "assembly_hierarchy=<val>", "Hierarchy used for the assembly of the coarse operator", Arg::positive),
+        std::forward_as_tuple(std::string(HPDDM_REGEX_LEVEL) + "assembly_hierarchy=<val>", "Hierarchy used for the assembly of the coarse operator (1 for a flat assembly, default to a two-level tree above HPDDM_ASSEMBLY_FAN_IN processes per main process)", Arg::positive),
 #if HPDDM_INEXACT_COARSE_OPERATOR
         std::forward_as_tuple(std::string(HPDDM_REGEX_LEVEL) + "aggregate_size=<val>", "Number of main processes per MPI sub-communicators", Arg::positive),
 #endif
@@ -326,6 +353,7 @@ inline void Option::version() const {
         " │  Inexact coarse spaces: " + std::string(bool(HPDDM_INEXACT_COARSE_OPERATOR) ? "true" : "false"),
         " │  QR algorithm: " + std::string(HPDDM_STR(HPDDM_QR)),
         " │  asynchronous collectives: " + std::string(bool(HPDDM_ICOLLECTIVE) ? "true" : "false"),
+        " │  neighborhood collectives: " + std::string(bool(HPDDM_NEIGHBOR_COLLECTIVE) ? "true" : "false"),
         " │  mixed precision arithmetic: " + std::string(bool(HPDDM_MIXED_PRECISION) ? "true" : "false"),
         " │  subdomain solver: " + std::string(HPDDM_STR(SUBDOMAIN)),
         " │  coarse operator solver: " + std::string(HPDDM_STR(COARSEOPERATOR)),
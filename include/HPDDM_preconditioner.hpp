@@ -311,16 +311,6 @@ class Preconditioner : public Subdomain<K> {
                 co_->setLocal(deflation);
             }
         }
-#if !HPDDM_PETSC
-        /* Function: callSolve
-         *
-         *  Applies <Preconditioner::s> to multiple right-hand sides in-place.
-         *
-         * Parameters:
-         *    x              - Input right-hand sides, solution vectors are stored in-place.
-         *    n              - Number of input right-hand sides. */
-        void callSolve(K* const x, const unsigned short& n = 1) const { s_.solve(x, n); }
-#endif
         /* Function: getVectors
          *  Returns a constant pointer to <Preconditioner::ev>. */
         const K* const* getVectors() const { return ev_; }
@@ -354,6 +344,19 @@ class Preconditioner : public Subdomain<K> {
 #endif
 #endif
                                                                                               { }
+#if !HPDDM_PETSC
+        /* Function: callSolve
+         *
+         *  Applies <Preconditioner::s> to multiple right-hand sides in-place. This function is not virtual and is thus protected, so that it is only reached from derived classes that know <Preconditioner::s> is the local solver, e.g., it is hidden by <Schwarz::callSolve>, which may use a single-precision factorization instead.
+         *
+         * Parameters:
+         *    x              - Input right-hand sides, solution vectors are stored in-place.
+         *    n              - Number of input right-hand sides. */
+        void callSolve(K* const x, const unsigned short& n = 1) const {
+            Profiler::Event event(Profiler::SOLVE);
+            s_.solve(x, n);
+        }
+#endif
 #if HPDDM_SCHWARZ || HPDDM_FETI || HPDDM_BDD || (HPDDM_PETSC && defined(PETSC_PCHPDDM_MAXLEVELS))
         void dtor() {
 #if !HPDDM_PETSC
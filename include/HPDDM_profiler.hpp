@@ -0,0 +1,224 @@
+/*
+   This file is part of HPDDM.
+
+   Author(s): Pierre Jolivet <pierre@joliv.et>
+        Date: 2026-10-17
+
+   Copyright (C) 2016-     Centre National de la Recherche Scientifique
+
+   HPDDM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published
+   by the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   HPDDM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with HPDDM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPDDM_PROFILER_HPP_
+#define HPDDM_PROFILER_HPP_
+
+#include <chrono>
+#include "HPDDM_singleton.hpp"
+
+namespace HPDDM {
+/* Class: Profiler
+ *  A class to record, on each process, the time spent in, the number of calls to, and the number of bytes communicated by the main phases of HPDDM. Counters are inclusive, e.g., the time spent in <Subdomain::exchange> is also accounted for in <Schwarz::GMV>. Nothing is recorded unless the option -hpddm_profiling is set or <Profiler::start> is called. */
+class Profiler : private Singleton {
+    public:
+        /* Enum: Phase
+         *
+         *  Instrumented phases.
+         *
+         * FACTORIZATION      - Numerical factorizations of local matrices.
+         * SOLVE              - Local solves.
+         * EXCHANGE           - Exchanges of values of duplicated unknowns, see <Subdomain::exchange>, including the ones overlapped with computations in <Subdomain::exchangeBegin>, for which only the time spent outside of the overlap is accounted for.
+         * GMV                - Global matrix-vector products, see <Schwarz::GMV>.
+         * ORTHOGONALIZATION  - Global reductions of the orthogonalization processes of Krylov methods.
+         * COARSE_CORRECTION  - Coarse corrections, including the transfers between the fine and the coarse grids, see <Coarse operator::callSolver>.
+         * COARSE_SOLVE       - Solutions of coarse systems.
+         * EIGENSOLVE         - Local generalized eigenvalue problems. */
+        enum Phase : unsigned short {
+            FACTORIZATION, SOLVE, EXCHANGE, GMV, ORTHOGONALIZATION, COARSE_CORRECTION, COARSE_SOLVE, EIGENSOLVE
+        };
+        static constexpr unsigned short phases = EIGENSOLVE + 1;
+        struct Counter {
+            /* Variable: time
+             *  Elapsed time in seconds. */
+            double               time_;
+            /* Variable: calls
+             *  Number of calls. */
+            unsigned long long  calls_;
+            /* Variable: bytes
+             *  Number of bytes sent. */
+            unsigned long long  bytes_;
+        };
+    private:
+        /* Variable: counters
+         *  Counters of all phases. */
+        Counter     counters_[phases];
+        /* Variable: revision
+         *  Value of <Option::revision> when <Profiler::active> was last resolved. */
+        std::size_t revision_;
+        bool          active_;
+        /* Variable: forced
+         *  True if <Profiler::start> or <Profiler::stop> has been called, so that options are not looked up anymore. */
+        bool          forced_;
+        static Profiler& instance() {
+            static Profiler& p = *get();
+            return p;
+        }
+        static void write(std::ostream& output, bool csv, int size, const double* const min, const double* const sum, const double* const max) {
+            static const char* const fields[3] = { "time", "calls", "bytes" };
+            output << std::scientific << std::setprecision(6);
+            if(csv) {
+                output << "phase";
+                for(unsigned short j = 0; j < 3; ++j)
+                    output << "," << fields[j] << "_min," << fields[j] << "_avg," << fields[j] << "_max";
+                output << "\n";
+                for(unsigned short i = 0; i < phases; ++i) {
+                    output << name(static_cast<Phase>(i));
+                    for(unsigned short j = 0; j < 3; ++j)
+                        output << "," << min[3 * i + j] << "," << sum[3 * i + j] / size << "," << max[3 * i + j];
+                    output << "\n";
+                }
+            }
+            else {
+                output << "{\n  \"processes\": " << size << ",\n  \"phases\": {\n";
+                for(unsigned short i = 0; i < phases; ++i) {
+                    output << "    \"" << name(static_cast<Phase>(i)) << "\": {";
+                    for(unsigned short j = 0; j < 3; ++j)
+                        output << (j ? ", " : " ") << "\"" << fields[j] << "\": { \"min\": " << min[3 * i + j] << ", \"avg\": " << sum[3 * i + j] / size << ", \"max\": " << max[3 * i + j] << " }";
+                    output << " }" << (i < phases - 1 ? "," : "") << "\n";
+                }
+                output << "  }\n}\n";
+            }
+        }
+    public:
+        template<int N>
+        explicit Profiler(Singleton::construct_key<N>) : counters_(), revision_(std::numeric_limits<std::size_t>::max()), active_(), forced_() { }
+        /* Function: get
+         *  Returns a shared pointer to the <Profiler>. */
+        template<int N = 0>
+        static std::shared_ptr<Profiler> get() {
+            return Singleton::get<Profiler, N>();
+        }
+        /* Function: name
+         *  Returns the name of a phase. */
+        static const char* name(Phase p) {
+            static const char* const names[phases] = { "factorization", "solve", "exchange", "GMV", "orthogonalization", "coarse_correction", "coarse_solve", "eigensolve" };
+            return names[p];
+        }
+        /* Function: active
+         *  Returns true if counters are recorded. */
+        bool active() {
+#if !HPDDM_PETSC
+            if(!forced_ && revision_ != Option::revision()) {
+                const Option& opt = *Option::get();
+                if(opt.getPrefix().empty()) {
+                    active_ = opt.val<char>("profiling", 0) || !opt.prefix("profiling_output", true).empty();
+                    revision_ = Option::revision();
+                }
+            }
+#endif
+            return active_;
+        }
+        /* Function: start
+         *  Starts recording counters, regardless of the options. */
+        void start() {
+            forced_ = active_ = true;
+        }
+        /* Function: stop
+         *  Stops recording counters, regardless of the options. */
+        void stop() {
+            forced_ = true;
+            active_ = false;
+        }
+        /* Function: reset
+         *  Sets all counters to zero. */
+        void reset() {
+            std::fill_n(counters_, phases, Counter());
+        }
+        /* Function: operator[]
+         *  Returns a constant reference to the counter of a phase on the current process. */
+        const Counter& operator[](Phase p) const {
+            return counters_[p];
+        }
+        /* Function: dump
+         *
+         *  Computes the minimum, average, and maximum values of the counters over all processes, and saves them to disk. This is a collective operation.
+         *
+         * Parameters:
+         *    comm           - MPI communicator.
+         *    filename       - Output file, in CSV format if its extension is .csv, in JSON format otherwise. If empty, the value of the option -hpddm_profiling_output is used, and nothing is saved if it is not set either. */
+#if HPDDM_MPI
+        void dump(const MPI_Comm& comm, std::string filename = "") const {
+#else
+        void dump(std::string filename = "") const {
+#endif
+#if !HPDDM_PETSC
+            if(filename.empty())
+                filename = Option::get()->prefix("profiling_output", true);
+#endif
+            if(filename.empty())
+                return;
+            double min[3 * phases], sum[3 * phases], max[3 * phases];
+            for(unsigned short i = 0; i < phases; ++i) {
+                min[3 * i] = counters_[i].time_;
+                min[3 * i + 1] = counters_[i].calls_;
+                min[3 * i + 2] = counters_[i].bytes_;
+            }
+            std::copy_n(min, 3 * phases, sum);
+            std::copy_n(min, 3 * phases, max);
+            int rank = 0, size = 1;
+#if HPDDM_MPI
+            MPI_Comm_rank(comm, &rank);
+            MPI_Comm_size(comm, &size);
+            MPI_Reduce(rank == 0 ? MPI_IN_PLACE : min, min, 3 * phases, MPI_DOUBLE, MPI_MIN, 0, comm);
+            MPI_Reduce(rank == 0 ? MPI_IN_PLACE : sum, sum, 3 * phases, MPI_DOUBLE, MPI_SUM, 0, comm);
+            MPI_Reduce(rank == 0 ? MPI_IN_PLACE : max, max, 3 * phases, MPI_DOUBLE, MPI_MAX, 0, comm);
+#endif
+            if(rank == 0) {
+                std::ofstream output(filename);
+                if(output.good())
+                    write(output, filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".csv") == 0, size, min, sum, max);
+                else
+                    std::cerr << "WARNING -- could not open " << filename << std::endl;
+            }
+        }
+        /* Class: Event
+         *  Accounts for a number of calls to a phase, one by default, the time spent until the end of the enclosing scope, and a number of bytes sent. The number of bytes may also be given by a function object, which is then only evaluated if counters are recorded. */
+        class Event {
+            private:
+                Counter* const                                     counter_;
+                std::chrono::steady_clock::time_point                start_;
+            public:
+                explicit Event(Phase p, std::size_t bytes = 0, unsigned short calls = 1) : counter_(instance().active() ? instance().counters_ + p : nullptr) {
+                    if(counter_) {
+                        counter_->calls_ += calls;
+                        counter_->bytes_ += bytes;
+                        start_ = std::chrono::steady_clock::now();
+                    }
+                }
+                template<class F, typename std::enable_if<!std::is_integral<F>::value>::type* = nullptr>
+                explicit Event(Phase p, const F& bytes) : counter_(instance().active() ? instance().counters_ + p : nullptr) {
+                    if(counter_) {
+                        ++counter_->calls_;
+                        counter_->bytes_ += bytes();
+                        start_ = std::chrono::steady_clock::now();
+                    }
+                }
+                Event(const Event&) = delete;
+                ~Event() {
+                    if(counter_)
+                        counter_->time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+                }
+        };
+};
+} // HPDDM
+#endif // HPDDM_PROFILER_HPP_
@@ -150,6 +150,37 @@ class Schur : public Preconditioner<
          *  Dimension of the kernel of <Subdomain::a>. */
         unsigned short deficiency_;
 #if HPDDM_FETI || HPDDM_BDD
+        /* Variable: dense
+         *  Explicit local Schur complement formed by <Schur::callNumfactPreconditioner>, only used by <Schur::applyLocalSchurComplement>. */
+        std::vector<K>          dense_;
+        /* Variable: buffer
+         *  Workspace of <Schur::applyLocalSchurComplement(n)>, grown on demand. */
+        mutable std::vector<K> buffer_;
+        /* Function: buffer
+         *  Returns <Schur::buffer> with at least a given number of entries. */
+        K* buffer(std::size_t size) const {
+            if(buffer_.size() < size)
+                buffer_.resize(size);
+            return buffer_.data();
+        }
+        /* Function: factorization
+         *  Returns the number of entries of the factors of <Schur::ii>, or an estimate of it if the local solver does not report it. */
+        template<class T>
+        static auto factorization(const T& s, const MatrixCSR<K>* const, int) -> decltype(static_cast<double>(s.nnz())) { return s.nnz(); }
+        template<class T>
+        static double factorization(const T&, const MatrixCSR<K>* const A, long) { return static_cast<double>(HPDDM_SCHUR_FILL) * A->nnz_; }
+        /* Function: explicitSchurComplement
+         *  Returns true if the local Schur complement should be formed explicitly. With the option -hpddm_substructuring_schur_complement set to auto, the number of floating-point operations of the expected number of implicit applications is compared to the one of the explicit formation followed by as many dense applications. */
+        bool explicitSchurComplement() const {
+            const Option& opt = *Option::get();
+            const char policy = opt.val<char>(super::prefix("substructuring_schur_complement"), HPDDM_SUBSTRUCTURING_SCHUR_COMPLEMENT_AUTO);
+            if(!Subdomain<K>::dof_ || policy != HPDDM_SUBSTRUCTURING_SCHUR_COMPLEMENT_AUTO)
+                return Subdomain<K>::dof_ && policy == HPDDM_SUBSTRUCTURING_SCHUR_COMPLEMENT_EXPLICIT;
+            const double applications = opt.val<unsigned short>(super::prefix("substructuring_schur_applications"), opt.val<unsigned short>(super::prefix("max_it"), 100));
+            const double dof = Subdomain<K>::dof_;
+            const double implicit = (ii_->n_ ? (ii_->sym_ ? 4.0 : 2.0) * factorization(super::s_, ii_, 0) : 0.0) + 4.0 * bi_->nnz_ + (bb_->sym_ ? 4.0 : 2.0) * bb_->nnz_;
+            return applications * (implicit - 2.0 * dof * dof) > dof * implicit;
+        }
         /* Function: solveGEVP
          *
          *  Solves the GenEO problem.
@@ -161,6 +192,7 @@ class Schur : public Preconditioner<
          *    d              - Constant pointer to a partition of unity of the primal unknowns, cf. <Bdd::m>. */
         template<char L>
         void solveGEVP(const underlying_type<K>* const d) {
+            Profiler::Event event(Profiler::EIGENSOLVE);
             Option& opt = *Option::get();
             const bool resetPrefix = (opt.getPrefix().size() == 0 && super::prefix().size() != 0);
             if(resetPrefix)
@@ -292,6 +324,7 @@ class Schur : public Preconditioner<
         }
         template<unsigned short excluded, class Operator, class Prcndtnr>
         std::pair<MPI_Request, const K*>* buildTwo(Prcndtnr* B, const MPI_Comm& comm) {
+            Subdomain<K>::template destroy<false>();
             if(!Option::get()->set(super::prefix("geneo_nu"))) {
                 if(!super::co_)
                     super::co_ = new typename std::remove_reference<decltype(*super::co_)>::type;
@@ -326,6 +359,10 @@ class Schur : public Preconditioner<
             schur_ = nullptr;
             delete [] work_;
             work_ = nullptr;
+#if HPDDM_FETI || HPDDM_BDD
+            std::vector<K>().swap(dense_);
+            std::vector<K>().swap(buffer_);
+#endif
         }
         /* Typedef: super
          *  Type of the immediate parent class <Preconditioner>. */
@@ -357,10 +394,13 @@ class Schur : public Preconditioner<
         }
 #if HPDDM_FETI || HPDDM_BDD
         /* Function: callNumfact
-         *  Factorizes <Subdomain::a>. */
+         *  Factorizes <Subdomain::a> and discards the search directions recycled by <Iterative method::PCG>. */
         void callNumfact() {
             if(Subdomain<K>::a_) {
-                pinv_ = new Solver<K>();
+                Profiler::Event event(Profiler::FACTORIZATION);
+                Subdomain<K>::template destroy<false>();
+                if(!pinv_)
+                    pinv_ = new Solver<K>();
                 Solver<K>* p = static_cast<Solver<K>*>(pinv_);
                 if(deficiency_) {
 #if defined(MUMPSSUB) || defined(PASTIXSUB)
@@ -395,6 +435,7 @@ class Schur : public Preconditioner<
 #else
                     schur_[1] = bi_->m_ + 1;
 #endif
+                    Profiler::Event event(Profiler::FACTORIZATION);
                     super::s_.numfact(Subdomain<K>::a_, true, schur_);
                 }
             }
@@ -405,12 +446,30 @@ class Schur : public Preconditioner<
 #endif
         }
         /* Function: callNumfactPreconditioner
-         *  Factorizes <Schur::ii> if <Schur::schur> is not available. */
+         *  Factorizes <Schur::ii> if <Schur::schur> is not available, and forms <Schur::dense> if <Schur::explicitSchurComplement> returns true, using multiple right-hand sides per solve. Search directions recycled by <Iterative method::PCG> are discarded. */
         void callNumfactPreconditioner() {
+            Subdomain<K>::template destroy<false>();
             if(!schur_) {
                 if(ii_) {
+                    Profiler::Event event(Profiler::FACTORIZATION);
                     if(ii_->n_)
                         super::s_.numfact(ii_);
+                    std::vector<K>().swap(dense_);
+                    if(explicitSchurComplement()) {
+                        const int dof = Subdomain<K>::dof_;
+                        const int block = std::max(1, std::min({ dof, static_cast<int>(std::numeric_limits<unsigned short>::max()), static_cast<int>((static_cast<std::size_t>(dof) * dof) / std::max(1, bi_->m_)) }));
+                        std::vector<K> schur(static_cast<std::size_t>(dof) * dof), identity(static_cast<std::size_t>(dof) * block);
+                        for(int i = 0; i < dof; i += block) {
+                            const int n = std::min(block, dof - i);
+                            for(int j = 0; j < n; ++j)
+                                identity[i + j + static_cast<std::size_t>(j) * dof] = K(1.0);
+                            applyLocalSchurComplement(identity.data(), schur.data() + static_cast<std::size_t>(i) * dof, n);
+                            for(int j = 0; j < n; ++j)
+                                identity[i + j + static_cast<std::size_t>(j) * dof] = K();
+                        }
+                        dense_.swap(schur);
+                        std::vector<K>().swap(buffer_);
+                    }
                 }
                 else
                     std::cerr << "The matrix 'ii_' has not been allocated => impossible to build the Dirichlet preconditioner" << std::endl;
@@ -653,21 +712,37 @@ class Schur : public Preconditioner<
          *
          * See also: <Feti::applyLocalPreconditioner(n)>. */
         void applyLocalSchurComplement(K*& in, const int& n) const {
-            K* out = new K[n * Subdomain<K>::dof_]();
-            if(!schur_) {
+            K* const out = buffer(static_cast<std::size_t>(n) * ((schur_ || !dense_.empty() ? 0 : bi_->m_) + Subdomain<K>::dof_)) + (schur_ || !dense_.empty() ? 0 : static_cast<std::size_t>(n) * bi_->m_);
+            applyLocalSchurComplement(in, out, n);
+            std::copy_n(out, n * Subdomain<K>::dof_, in);
+        }
+        /* Function: applyLocalSchurComplement(n)
+         *
+         *  Applies the local Schur complement to multiple right-hand sides.
+         *
+         * Parameters:
+         *    in             - Input vectors.
+         *    out            - Output vectors.
+         *    n              - Number of input vectors.
+         *
+         * See also: <Bdd::apply>. */
+        void applyLocalSchurComplement(const K* const in, K* const out, const int& n) const {
+            Profiler::Event event(Profiler::SOLVE);
+            if(!dense_.empty())
+                Blas<K>::gemm("N", "N", &(Subdomain<K>::dof_), &n, &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), dense_.data(), &(Subdomain<K>::dof_), in, &(Subdomain<K>::dof_), &(Wrapper<K>::d__0), out, &(Subdomain<K>::dof_));
+            else if(!schur_) {
                 if(bi_->m_) {
-                    K* tmp = new K[n * bi_->m_];
+                    K* const tmp = buffer(static_cast<std::size_t>(n) * bi_->m_);
                     Wrapper<K>::template csrmm<Wrapper<K>::I>(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), &n, &bi_->m_, &(Wrapper<K>::d__1), false, bi_->a_, bi_->ia_, bi_->ja_, in, &(Wrapper<K>::d__0), tmp);
                     super::s_.solve(tmp, n);
                     Wrapper<K>::template csrmm<Wrapper<K>::I>("N", &(Subdomain<K>::dof_), &n, &bi_->m_, &(Wrapper<K>::d__1), false, bi_->a_, bi_->ia_, bi_->ja_, tmp, &(Wrapper<K>::d__0), out);
-                    delete [] tmp;
                 }
+                else
+                    std::fill_n(out, n * Subdomain<K>::dof_, K());
                 Wrapper<K>::template csrmm<Wrapper<K>::I>("N", &(Subdomain<K>::dof_), &n, &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), true, bb_->a_, bb_->ia_, bb_->ja_, in, &(Wrapper<K>::d__2), out);
             }
             else
                 Blas<K>::symm("L", "L", &(Subdomain<K>::dof_), &n, &(Wrapper<K>::d__1), schur_, &(Subdomain<K>::dof_), in, &(Subdomain<K>::dof_), &(Wrapper<K>::d__0), out, &(Subdomain<K>::dof_));
-            delete [] in;
-            in = out;
         }
         /* Function: applyLocalSchurComplement
          *
@@ -679,7 +754,13 @@ class Schur : public Preconditioner<
          *
          * See also: <Feti::applyLocalPreconditioner> and <Bdd::apply>. */
         void applyLocalSchurComplement(K* const in, K* const& out = nullptr) const {
-            if(!schur_) {
+            Profiler::Event event(Profiler::SOLVE);
+            if(!dense_.empty()) {
+                Blas<K>::gemv("N", &(Subdomain<K>::dof_), &(Subdomain<K>::dof_), &(Wrapper<K>::d__1), dense_.data(), &(Subdomain<K>::dof_), in, &i__1, &(Wrapper<K>::d__0), out ? out : work_ + bi_->m_, &i__1);
+                if(!out)
+                    std::copy_n(work_ + bi_->m_, Subdomain<K>::dof_, in);
+            }
+            else if(!schur_) {
                 Wrapper<K>::template csrmv<Wrapper<K>::I>(&(Wrapper<K>::transc), &(Subdomain<K>::dof_), &bi_->m_, &(Wrapper<K>::d__1), false, bi_->a_, bi_->ia_, bi_->ja_, in, &(Wrapper<K>::d__0), work_);
                 if(bi_->m_)
                     super::s_.solve(work_);
@@ -792,9 +873,14 @@ class Schur : public Preconditioner<
          *    x              - Solution vector.
          *    f              - Right-hand side.
          *    storage        - Array to store both values.
+         *    mu             - Number of right-hand sides.
          *
          * See also: <Schwarz::computeResidual>. */
-        void computeResidual(const K* const x, const K* const f, underlying_type<K>* const storage, const unsigned short, const unsigned short) const {
+        void computeResidual(const K* const x, const K* const f, underlying_type<K>* const storage, const unsigned short mu, const unsigned short) const {
+            for(unsigned short nu = 0; nu < mu; ++nu)
+                computeResidual(x + nu * Subdomain<K>::a_->n_, f + nu * Subdomain<K>::a_->n_, storage + 2 * nu);
+        }
+        void computeResidual(const K* const x, const K* const f, underlying_type<K>* const storage) const {
             K* tmp = new K[Subdomain<K>::a_->n_];
             std::copy_n(f, Subdomain<K>::a_->n_, tmp);
             bool allocate = Subdomain<K>::setBuffer();
@@ -107,22 +107,90 @@ class Schwarz : public Preconditioner<
         /* Variable: type
          *  Type of <Prcndtnr> used in <Schwarz::apply> and <Schwarz::deflation>. */
         Prcndtnr               type_;
+        /* Variable: sell
+         *  Optional SELL-C-sigma copy of <Subdomain::a> used in <Schwarz::GMV>. */
+        MatrixSELL<K>*         sell_;
+        /* Function: buildSELL
+         *  Builds <Schwarz::sell> if requested, with the rows shared with neighboring subdomains first, see <Subdomain::split>. */
+        void buildSELL(const std::string& prefix) {
+            delete sell_;
+            sell_ = nullptr;
+            const Option& opt = *Option::get();
+            const unsigned short c = opt.val<unsigned short>(prefix + "schwarz_sell_chunk", 0);
+            if(c && Subdomain<K>::a_ && Subdomain<K>::a_->ia_)
+                sell_ = new MatrixSELL<K>(Subdomain<K>::a_, c, opt.val<int>(prefix + "schwarz_sell_sigma", 1), Subdomain<K>::split_.empty() ? nullptr : Subdomain<K>::split_.data(), Subdomain<K>::boundary_);
+        }
+        /* Typedef: single_type
+         *  Scalar type of <Schwarz::f>, the single-precision counterpart of K when supported by the subdomain solver. */
+#if defined(SUITESPARSESUB) || defined(DISSECTIONSUB) || defined(PETSCSUB)
+        typedef K single_type;
+#else
+        typedef typename std::conditional<std::is_same<underlying_type<K>, double>::value, typename std::conditional<Wrapper<K>::is_complex, std::complex<float>, float>::type, K>::type single_type;
+#endif
+        /* Variable: f
+         *  Optional single-precision factorization used in place of <Preconditioner::s>. */
+        Solver<single_type>*      f_;
+        /* Variable: sa
+         *  Single-precision copy of the matrix factorized by <Schwarz::f>. */
+        MatrixCSR<single_type>*  sa_;
+        /* Variable: ra
+         *  Copy of the matrix used to compute residuals during iterative refinement, when it is not <Subdomain::a>. */
+        MatrixCSR<K>*            ra_;
+        /* Variable: steps
+         *  Number of steps of iterative refinement after each application of <Schwarz::f>. */
+        unsigned short        steps_;
+        void destroySingle() {
+            delete f_;
+            f_ = nullptr;
+            delete sa_;
+            sa_ = nullptr;
+            delete ra_;
+            ra_ = nullptr;
+            steps_ = 0;
+        }
+        /* Function: singleNumfact
+         *
+         *  Factorizes a single-precision copy of a matrix with <Schwarz::f> and releases <Preconditioner::s>.
+         *
+         * Parameters:
+         *    A              - Matrix to factorize.
+         *    steps          - Number of steps of iterative refinement. */
+        template<char N>
+        void singleNumfact(const MatrixCSR<K>* const A, const unsigned short steps) {
+            destroySingle();
+            super::s_.dtor();
+            sa_ = new MatrixCSR<single_type>(A->n_, A->m_, A->nnz_, A->sym_);
+            std::copy_n(A->ia_, A->n_ + 1, sa_->ia_);
+            std::copy_n(A->ja_, A->nnz_, sa_->ja_);
+            std::copy_n(A->a_, A->nnz_, sa_->a_);
+            f_ = new Solver<single_type>;
+            f_->template numfact<N>(sa_);
+            steps_ = steps;
+            if(steps_ && A != Subdomain<K>::a_)
+                ra_ = new MatrixCSR<K>(*A);
+        }
 #endif
     public:
         Schwarz() : d_()
 #if HPDDM_SCHWARZ
-                        , hash_(), type_(Prcndtnr::NO)
+                        , hash_(), type_(Prcndtnr::NO), sell_(), f_(), sa_(), ra_(), steps_()
 #endif
                                                        { }
         explicit Schwarz(const Subdomain<K>& s) : super(s), d_()
 #if HPDDM_SCHWARZ
-                                                                , hash_(), type_(Prcndtnr::NO)
+                                                                , hash_(), type_(Prcndtnr::NO), sell_(), f_(), sa_(), ra_(), steps_()
 #endif
                                                                                                { }
 #if HPDDM_DENSE
         virtual
 #endif
-        ~Schwarz() { d_ = nullptr; }
+        ~Schwarz() {
+            d_ = nullptr;
+#if HPDDM_SCHWARZ
+            delete sell_;
+            destroySingle();
+#endif
+        }
         void operator=(const Schwarz& B) {
             dtor();
             Subdomain<K>::a_ = B.a_ ? new MatrixCSR<K>(*B.a_) : nullptr;
@@ -137,6 +205,11 @@ class Schwarz : public Preconditioner<
             super::super::dtor();
             super::dtor();
             d_ = nullptr;
+#if HPDDM_SCHWARZ
+            delete sell_;
+            sell_ = nullptr;
+            destroySingle();
+#endif
         }
         /* Typedef: super
          *  Type of the immediate parent class <Preconditioner>. */
@@ -157,7 +230,7 @@ class Schwarz : public Preconditioner<
         void exchange(K* const x, const unsigned short& mu = 1) const {
             bool free = false;
             if(allocate)
-                free = Subdomain<K>::setBuffer();
+                free = Subdomain<K>::setBuffer(nullptr, 0, mu);
             Wrapper<K>::diag(Subdomain<K>::dof_, d_, x, mu);
             Subdomain<K>::exchange(x, mu);
             if(allocate)
@@ -330,6 +403,7 @@ class Schwarz : public Preconditioner<
                     super::destroySolver();
                 }
             }
+            buildSELL("");
             switch(m) {
                 case HPDDM_SCHWARZ_METHOD_SORAS: type_ = (A ? Prcndtnr::OS : Prcndtnr::SY); break;
                 case HPDDM_SCHWARZ_METHOD_ASM:   type_ = Prcndtnr::SY; break;
@@ -337,8 +411,15 @@ class Schwarz : public Preconditioner<
                 default:                         type_ = (A && (m == HPDDM_SCHWARZ_METHOD_ORAS || m == HPDDM_SCHWARZ_METHOD_OSM) ? Prcndtnr::OG : Prcndtnr::GE);
             }
             m = opt.val<unsigned short>("reuse_preconditioner");
-            if(m <= 1)
-                super::s_.template numfact<N>(type_ == Prcndtnr::OS || type_ == Prcndtnr::OG ? A : Subdomain<K>::a_);
+            if(m <= 1) {
+                Profiler::Event event(Profiler::FACTORIZATION);
+                if(!std::is_same<single_type, K>::value && opt.val<char>("schwarz_mixed_precision", 0))
+                    singleNumfact<N>(type_ == Prcndtnr::OS || type_ == Prcndtnr::OG ? A : Subdomain<K>::a_, opt.val<unsigned short>("schwarz_refinement_steps", 0));
+                else {
+                    destroySingle();
+                    super::s_.template numfact<N>(type_ == Prcndtnr::OS || type_ == Prcndtnr::OG ? A : Subdomain<K>::a_);
+                }
+            }
             if(m >= 1)
                 opt["reuse_preconditioner"] += 1;
             if(resetPrefix)
@@ -349,6 +430,8 @@ class Schwarz : public Preconditioner<
             const bool fact = super::setMatrix(a) && !Option::get()->any_of(prefix + "schwarz_method", { HPDDM_SCHWARZ_METHOD_ORAS, HPDDM_SCHWARZ_METHOD_SORAS, HPDDM_SCHWARZ_METHOD_OSM, HPDDM_SCHWARZ_METHOD_NONE });
             if(fact)
                 callNumfact(a);
+            else
+                buildSELL(prefix);
         }
         /* Function: multiplicityScaling
          *
@@ -358,6 +441,28 @@ class Schwarz : public Preconditioner<
          *    d              - Array of values. */
         void multiplicityScaling(underlying_type<K>* const d) const {
             bool allocate = Subdomain<K>::setBuffer();
+#if HPDDM_NEIGHBOR_COLLECTIVE
+            if(Subdomain<K>::graph_ != MPI_COMM_NULL) {
+                const unsigned short size = Subdomain<K>::map_.size();
+                std::vector<underlying_type<K>*> buff(2 * size);
+                for(unsigned short i = 0; i < 2 * size; ++i)
+                    buff[i] = reinterpret_cast<underlying_type<K>*>(Subdomain<K>::buff_[i]);
+                for(unsigned short i = 0; i < size; ++i)
+                    Wrapper<underlying_type<K>>::gthr(Subdomain<K>::map_[i].second.size(), d, buff[size + i], Subdomain<K>::map_[i].second.data());
+                Subdomain<K>::neighborExchange(buff.data());
+                std::fill_n(d, Subdomain<K>::dof_, 1.0);
+                for(unsigned short i = 0; i < size; ++i) {
+                    for(unsigned int j = 0; j < Subdomain<K>::map_[i].second.size(); ++j) {
+                        if(std::abs(buff[size + i][j]) < HPDDM_EPS)
+                            d[Subdomain<K>::map_[i].second[j]] = 0.0;
+                        else
+                            d[Subdomain<K>::map_[i].second[j]] /= 1.0 + d[Subdomain<K>::map_[i].second[j]] * buff[i][j] / buff[size + i][j];
+                    }
+                }
+                Subdomain<K>::clearBuffer(allocate);
+                return;
+            }
+#endif
             for(unsigned short i = 0, size = Subdomain<K>::map_.size(); i < size; ++i) {
                 underlying_type<K>* const recv = reinterpret_cast<underlying_type<K>*>(Subdomain<K>::buff_[i]);
                 underlying_type<K>* const send = reinterpret_cast<underlying_type<K>*>(Subdomain<K>::buff_[size + i]);
@@ -476,7 +581,7 @@ class Schwarz : public Preconditioner<
         }
         template<bool excluded = false>
         bool start(const K* const b, K* const x, const unsigned short& mu = 1) const {
-            bool allocate = Subdomain<K>::setBuffer();
+            bool allocate = Subdomain<K>::setBuffer(nullptr, 0, mu);
             if(!excluded && Subdomain<K>::a_->ia_) {
                 const std::unordered_map<unsigned int, K> map = Subdomain<K>::boundaryConditions();
                 for(const std::pair<const unsigned int, K>& p : map)
@@ -486,14 +591,62 @@ class Schwarz : public Preconditioner<
             exchange(x, mu);
             if(super::co_) {
                 unsigned short k = 1;
-                const std::string prefix = super::prefix();
-                Option& opt = *Option::get();
-                if(opt.any_of(prefix + "krylov_method", { HPDDM_KRYLOV_METHOD_GCRODR, HPDDM_KRYLOV_METHOD_BGCRODR }) && !opt.val<unsigned short>(prefix + "recycle_same_system"))
-                    k = std::max(opt.val<int>(prefix + "recycle", 1), 1);
+                const auto& opt = super::snapshot();
+                if((opt.krylov_method_ == HPDDM_KRYLOV_METHOD_GCRODR || opt.krylov_method_ == HPDDM_KRYLOV_METHOD_BGCRODR) && !opt.recycle_same_system_)
+                    k = std::max(opt.recycle_, 1);
                 super::start(mu * k);
             }
             return allocate;
         }
+        /* Function: callSolve
+         *
+         *  Applies the local solver, either <Preconditioner::s> or <Schwarz::f> followed by <Schwarz::steps> steps of iterative refinement, to multiple right-hand sides in-place. This function hides <Preconditioner::callSolve>, which must not be used with <Schwarz::f>.
+         *
+         * Parameters:
+         *    x              - Input right-hand sides, solution vectors are stored in-place.
+         *    mu             - Number of input right-hand sides. */
+        void callSolve(K* const x, const unsigned short& mu = 1) const {
+            Profiler::Event event(Profiler::SOLVE);
+            if(!f_)
+                super::s_.solve(x, mu);
+            else {
+                const int dim = mu * Subdomain<K>::dof_;
+                K* const b = OptionsPrefix<K>::template workspace<K, 1>((steps_ ? 3 : 1) * dim);
+                single_type* const y = reinterpret_cast<single_type*>(steps_ ? b + 2 * dim : b);
+                if(steps_)
+                    std::copy_n(x, dim, b);
+                std::copy_n(x, dim, y);
+                f_->solve(y, mu);
+                std::copy_n(y, dim, x);
+                if(steps_) {
+                    const MatrixCSR<K>* const A = ra_ ? ra_ : Subdomain<K>::a_;
+                    const int n = mu;
+                    K* const r = b + dim;
+                    for(unsigned short i = 0; i < steps_; ++i) {
+                        if(HPDDM_NUMBERING == Wrapper<K>::I)
+                            Wrapper<K>::csrmm(A->sym_, &(Subdomain<K>::dof_), &n, A->a_, A->ia_, A->ja_, x, r);
+                        else if(A->ia_[Subdomain<K>::dof_] == A->nnz_)
+                            Wrapper<K>::template csrmm<'C'>(A->sym_, &(Subdomain<K>::dof_), &n, A->a_, A->ia_, A->ja_, x, r);
+                        else
+                            Wrapper<K>::template csrmm<'F'>(A->sym_, &(Subdomain<K>::dof_), &n, A->a_, A->ia_, A->ja_, x, r);
+                        Blas<K>::axpby(dim, 1.0, b, 1, -1.0, r, 1);                      // r = b - A x
+                        std::copy_n(r, dim, y);
+                        f_->solve(y, mu);
+                        std::transform(x, x + dim, y, x, [](const K& u, const single_type& v) { return u + static_cast<K>(v); });
+                    }
+                }
+            }
+        }
+        void callSolve(const K* const in, K* const out, const unsigned short& mu = 1) const {
+            if(!f_) {
+                Profiler::Event event(Profiler::SOLVE);
+                super::s_.solve(in, out, mu);
+            }
+            else {
+                std::copy_n(in, mu * Subdomain<K>::dof_, out);
+                callSolve(out, mu);
+            }
+        }
         /* Function: apply
          *
          *  Applies the global Schwarz preconditioner.
@@ -508,13 +661,13 @@ class Schwarz : public Preconditioner<
          *    work           - Workspace array. */
         template<bool excluded = false>
         int apply(const K* const in, K* const out, const unsigned short& mu = 1, K* work = nullptr) const {
-            const char correction = Option::get()->val<char>(super::prefix("schwarz_coarse_correction"), -1);
+            const char correction = super::snapshot().schwarz_coarse_correction_;
             if((!super::co_ && !super::cc_) || correction == -1) {
                 if(type_ == Prcndtnr::NO)
                     std::copy_n(in, mu * Subdomain<K>::dof_, out);
                 else if(type_ == Prcndtnr::GE || type_ == Prcndtnr::OG) {
                     if(!excluded) {
-                        super::s_.solve(in, out, mu);
+                        callSolve(in, out, mu);
                         exchange(out, mu);               // out = D A \ in
                     }
                 }
@@ -522,11 +675,11 @@ class Schwarz : public Preconditioner<
                     if(!excluded) {
                         if(type_ == Prcndtnr::OS) {
                             Wrapper<K>::diag(Subdomain<K>::dof_, d_, in, out, mu);
-                            super::s_.solve(out, mu);
+                            callSolve(out, mu);
                             Wrapper<K>::diag(Subdomain<K>::dof_, d_, out, mu);
                         }
                         else
-                            super::s_.solve(in, out, mu);
+                            callSolve(in, out, mu);
                         Subdomain<K>::exchange(out, mu); // out = A \ in
                     }
                 }
@@ -542,7 +695,7 @@ class Schwarz : public Preconditioner<
                     MPI_Request rq[2];
                     Ideflation<excluded>(in, out, mu, rq);
                     if(!excluded) {
-                        super::s_.solve(work, mu); // out = A \ in
+                        callSolve(work, mu); // out = A \ in
                         MPI_Waitall(2, rq, MPI_STATUSES_IGNORE);
                         const int k = mu;
                         Blas<K>::gemm("N", "N", &(Subdomain<K>::dof_), &k, super::getAddrLocal(), &(Wrapper<K>::d__1), *super::ev_, &(Subdomain<K>::dof_), super::uc_, super::getAddrLocal(), &(Wrapper<K>::d__0), out, &(Subdomain<K>::dof_)); // out = ev_ E \ ev_^T D in
@@ -554,7 +707,7 @@ class Schwarz : public Preconditioner<
 #else
                     deflation<excluded>(in, out, mu);
                     if(!excluded) {
-                        super::s_.solve(work, mu);
+                        callSolve(work, mu);
                         Blas<K>::axpy(&n, &(Wrapper<K>::d__1), work, &i__1, out, &i__1);
                         exchange(out, mu);
                     }
@@ -564,10 +717,9 @@ class Schwarz : public Preconditioner<
                     deflation<excluded>(in, out, mu);                                    // out = Z E \ Z^T in
                     if(!excluded) {
                         if(!Subdomain<K>::a_->ia_ && !Subdomain<K>::a_->ja_) {
-                            K* tmp = new K[mu * Subdomain<K>::dof_];
+                            K* const tmp = OptionsPrefix<K>::template workspace<K, 1>(mu * Subdomain<K>::dof_);
                             GMV(out, tmp, mu);
                             Blas<K>::axpby(n, -1.0, tmp, 1, 1.0, work, 1);
-                            delete [] tmp;
                         }
                         else {
                             if(HPDDM_NUMBERING == Wrapper<K>::I)
@@ -580,12 +732,12 @@ class Schwarz : public Preconditioner<
                         exchange(work, mu);                                              //  in = (I - A Z E \ Z^T) in
                         if(type_ == Prcndtnr::OS)
                             Wrapper<K>::diag(Subdomain<K>::dof_, d_, work, mu);
-                        super::s_.solve(work, mu);
+                        callSolve(work, mu);
                         exchange(work, mu);                                              //  in = D A \ (I - A Z E \ Z^T) in
                         n = mu * Subdomain<K>::dof_;
                         if(correction == HPDDM_SCHWARZ_COARSE_CORRECTION_BALANCED) {
                             if(!excluded) {
-                                K* tmp = new K[super::cc_ ? 2 * n : n];
+                                K* const tmp = OptionsPrefix<K>::template workspace<K, 1>(super::cc_ ? 2 * n : n);
                                 GMV(work, tmp, mu);
                                 if(super::cc_) {
                                     deflation<excluded>(tmp, tmp + n, mu);
@@ -595,7 +747,6 @@ class Schwarz : public Preconditioner<
                                     deflation<excluded>(nullptr, tmp, mu);
                                     Blas<K>::axpy(&n, &(Wrapper<K>::d__2), tmp, &i__1, work, &i__1);
                                 }
-                                delete [] tmp;
                             }
                             else
                                 deflation<excluded>(nullptr, nullptr, mu);
@@ -661,6 +812,7 @@ class Schwarz : public Preconditioner<
          *    B              - Right-hand side matrix (optional). */
         template<template<class> class Eps>
         void solveGEVP(MatrixCSR<K>* const& A, MatrixCSR<K>* const& B = nullptr, const MatrixCSR<K>* const& pattern = nullptr) {
+            Profiler::Event event(Profiler::EIGENSOLVE);
             Option& opt = *Option::get();
             const bool resetPrefix = (opt.getPrefix().size() == 0 && super::prefix().size() != 0);
             if(resetPrefix)
@@ -678,46 +830,91 @@ class Schwarz : public Preconditioner<
                 rhs = B;
             else
                 scaleIntoOverlap(A, rhs);
-            if(super::ev_) {
-                delete [] *super::ev_;
-                delete [] super::ev_;
+            const int n = Subdomain<K>::dof_;
+            const unsigned short k = super::ev_ && *super::ev_ ? (super::co_ ? super::co_->getLocal() : opt.val<unsigned short>("geneo_nu", 0)) : 0;
+            bool reuse = false;
+            underlying_type<K> residual = 0.0;
+            if(k && opt.set("geneo_reuse_tol")) {
+                std::vector<underlying_type<K>> evr(k);
+                residual = evp.check(A, rhs, super::ev_, k, evr.data());
+                if(residual <= opt.val("geneo_reuse_tol")) {
+                    if(!std::is_sorted(evr.cbegin(), evr.cend())) {
+                        std::vector<unsigned short> perm(k);
+                        std::iota(perm.begin(), perm.end(), 0);
+                        std::sort(perm.begin(), perm.end(), [&](unsigned short lhs, unsigned short rhs) { return evr[lhs] < evr[rhs]; });
+                        K* sorted = new K[k * n];
+                        for(unsigned short i = 0; i < k; ++i)
+                            std::copy_n(super::ev_[perm[i]], n, sorted + i * n);
+                        delete [] *super::ev_;
+                        for(unsigned short i = 0; i < k; ++i)
+                            super::ev_[i] = sorted + i * n;
+                        std::sort(evr.begin(), evr.end());
+                    }
+                    evp.nu_ = k;
+                    if(threshold > 0.0)
+                        evp.selectNu(evr.data(), super::ev_, Subdomain<K>::communicator_);
+                    reuse = true;
+                }
+            }
+            if(k && opt.val<char>("verbosity", 0) > 1 && (reuse || opt.val<char>("geneo_warm_start", 0))) {
+                std::cout << "GenEO " << (reuse ? "reuses" : "warm starts the eigensolver with") << " the " << k << " previous local eigenvector" << (k > 1 ? "s" : "");
+                if(opt.set("geneo_reuse_tol"))
+                    std::cout << " (relative residual " << residual << (reuse ? " <= " : " > ") << opt.val("geneo_reuse_tol") << ")";
+                std::cout << std::endl;
             }
+            if(!reuse) {
+                K** previous = nullptr;
+                if(super::ev_) {
+                    if(k && opt.val<char>("geneo_warm_start", 0)) {
+                        previous = super::ev_;
+                        evp.initialize(previous, k);
+                    }
+                    else {
+                        delete [] *super::ev_;
+                        delete [] super::ev_;
+                    }
+                    super::ev_ = nullptr;
+                }
 #if defined(MUMPSSUB) || defined(MKL_PARDISOSUB)
-            if(threshold > 0.0 && opt.val<char>("geneo_estimate_nu", 0) && (!B || B->hashIndices() == A->hashIndices())) {
-                K* difference = new K[A->nnz_];
-                std::copy_n(A->a_, A->nnz_, difference);
-                for(unsigned int i = 0; i < A->n_; ++i) {
-                    int* it = A->ja_ + A->ia_[i];
-                    for(unsigned int j = rhs->ia_[i]; j < rhs->ia_[i + 1]; ++j) {
-                        it = std::lower_bound(it, A->ja_ + A->ia_[i + 1], rhs->ja_[j]);
-                        difference[std::distance(A->ja_, it++)] -= threshold * rhs->a_[j];
+                if(threshold > 0.0 && opt.val<char>("geneo_estimate_nu", 0) && (!B || B->hashIndices() == A->hashIndices())) {
+                    K* difference = new K[A->nnz_];
+                    std::copy_n(A->a_, A->nnz_, difference);
+                    for(unsigned int i = 0; i < A->n_; ++i) {
+                        int* it = A->ja_ + A->ia_[i];
+                        for(unsigned int j = rhs->ia_[i]; j < rhs->ia_[i + 1]; ++j) {
+                            it = std::lower_bound(it, A->ja_ + A->ia_[i + 1], rhs->ja_[j]);
+                            difference[std::distance(A->ja_, it++)] -= threshold * rhs->a_[j];
+                        }
                     }
+                    std::swap(A->a_, difference);
+                    Solver<K> s;
+                    evp.nu_ = std::max(1, s.inertia(A));
+                    std::swap(A->a_, difference);
+                    delete [] difference;
                 }
-                std::swap(A->a_, difference);
-                Solver<K> s;
-                evp.nu_ = std::max(1, s.inertia(A));
-                std::swap(A->a_, difference);
-                delete [] difference;
-            }
 #endif
-            evp.template solve<Solver>(A, rhs, super::ev_, Subdomain<K>::communicator_, free ? &(super::s_) : nullptr);
-            if(rhs != B)
-                delete rhs;
+                evp.template solve<Solver>(A, rhs, super::ev_, Subdomain<K>::communicator_, free ? &(super::s_) : nullptr);
+                if(previous) {
+                    delete [] *previous;
+                    delete [] previous;
+                }
+            }
             if(free && A->getFree()) {
                 A->ia_ = nullptr;
                 A->ja_ = nullptr;
             }
+            if(rhs != B)
+                delete rhs;
             opt["geneo_nu"] = evp.nu_;
             if(super::co_)
                 super::co_->setLocal(evp.nu_);
-            const int n = Subdomain<K>::dof_;
             std::for_each(super::ev_, super::ev_ + evp.nu_, [&](K* const v) { std::replace_if(v, v + n, [](K x) { return std::abs(x) < 1.0 / (HPDDM_EPS * HPDDM_PEN); }, K()); });
             if(resetPrefix)
                 opt.setPrefix("");
         }
         /* Function: GMV
          *
-         *  Computes a global sparse matrix-vector product.
+         *  Computes a global sparse matrix-vector product. When possible, the rows of the unknowns shared with neighboring subdomains are computed first, so that communications are overlapped with the remaining interior rows, see <Subdomain::split>.
          *
          * Parameters:
          *    in             - Input vector.
@@ -726,6 +923,7 @@ class Schwarz : public Preconditioner<
         virtual int GMV(const K* const in, K* const out, const int& mu = 1) const = 0;
 #else
         int GMV(const K* const in, K* const out, const int& mu = 1, MatrixCSR<K>* const& A = nullptr) const {
+            Profiler::Event event(Profiler::GMV);
 #if 0
             K* tmp = new K[mu * Subdomain<K>::dof_];
             Wrapper<K>::diag(Subdomain<K>::dof_, d_, in, tmp, mu);
@@ -738,6 +936,54 @@ class Schwarz : public Preconditioner<
             delete [] tmp;
             Subdomain<K>::exchange(out, mu);
 #else
+#if HPDDM_SCHWARZ
+            if(!A && sell_) {
+                bool split = (Subdomain<K>::boundary_ && mu <= Subdomain<K>::mu_);
+#if HPDDM_NEIGHBOR_COLLECTIVE
+                split = split && Subdomain<K>::graph_ == MPI_COMM_NULL;
+#endif
+                if(split) {
+                    const int boundary = sell_->chunks(Subdomain<K>::boundary_);
+                    sell_->multiply(in, out, mu, d_, 0, boundary);
+                    Subdomain<K>::exchangeBegin(out, mu);
+                    sell_->multiply(in, out, mu, d_, boundary, sell_->chunks(Subdomain<K>::dof_));
+                    Subdomain<K>::exchangeEnd(out, mu);
+                }
+                else {
+                    sell_->multiply(in, out, mu, nullptr, 0, sell_->chunks(Subdomain<K>::dof_));
+                    exchange(out, mu);
+                }
+                return 0;
+            }
+#endif
+            bool split = (!A && Subdomain<K>::a_->ia_ && !Subdomain<K>::a_->sym_ && Subdomain<K>::boundary_ && mu <= Subdomain<K>::mu_);
+#if HPDDM_NEIGHBOR_COLLECTIVE
+            split = split && Subdomain<K>::graph_ == MPI_COMM_NULL;
+#endif
+            if(split) {
+                const MatrixCSR<K>* const a = Subdomain<K>::a_;
+                const int shift = (a->ia_[Subdomain<K>::dof_] == a->nnz_ ? 0 : 1);
+                const std::vector<int>& split = Subdomain<K>::split_;
+                auto product = [&](const int i) {
+                    const int row = split[i];
+                    for(int nu = 0; nu < mu; ++nu) {
+                        K sum = K();
+                        for(int j = a->ia_[row] - shift; j < a->ia_[row + 1] - shift; ++j)
+                            sum += a->a_[j] * in[a->ja_[j] - shift + nu * Subdomain<K>::dof_];
+                        out[row + nu * Subdomain<K>::dof_] = (d_ ? d_[row] * sum : sum);
+                    }
+                };
+                for(int i = 0; i < Subdomain<K>::boundary_; ++i)
+                    product(i);
+                Subdomain<K>::exchangeBegin(out, mu);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, HPDDM_GRANULARITY)
+#endif
+                for(int i = Subdomain<K>::boundary_; i < Subdomain<K>::dof_; ++i)
+                    product(i);
+                Subdomain<K>::exchangeEnd(out, mu);
+                return 0;
+            }
             if(A)
                 Wrapper<K>::csrmm(A->sym_, &A->n_, &mu, A->a_, A->ia_, A->ja_, in, out);
             else if(HPDDM_NUMBERING == Wrapper<K>::I)
@@ -766,7 +1012,7 @@ class Schwarz : public Preconditioner<
         void computeResidual(const K* const x, const K* const f, underlying_type<K>* const storage, const unsigned short mu = 1, const unsigned short norm = HPDDM_COMPUTE_RESIDUAL_L2) const {
             int dim = mu * Subdomain<K>::dof_;
             K* tmp = new K[dim];
-            bool allocate = Subdomain<K>::setBuffer();
+            bool allocate = Subdomain<K>::setBuffer(nullptr, 0, mu);
             GMV(x, tmp, mu);
             Subdomain<K>::clearBuffer(allocate);
             Blas<K>::axpy(&dim, &(Wrapper<K>::d__2), f, &i__1, tmp, &i__1);
@@ -60,8 +60,79 @@ class Subdomain
         /* Variable: dof
          *  Number of degrees of freedom in the current subdomain. */
         int                        dof_;
+        /* Variable: mu
+         *  Number of right-hand sides that fit in <Subdomain::buff>, i.e., that may be packed in a single message per neighbor. */
+        mutable unsigned short      mu_;
+        /* Variable: split
+         *  Rows of the unknowns shared with neighboring subdomains, followed by the remaining interior rows. */
+        std::vector<int>         split_;
+        /* Variable: boundary
+         *  Number of rows shared with neighboring subdomains in <Subdomain::split>. */
+        int                   boundary_;
+        /* Function: buildSplit
+         *  Builds <Subdomain::split> once <Subdomain::map> is known. */
+        void buildSplit() {
+            std::vector<char> shared(dof_);
+            for(const pairNeighbor& i : map_)
+                for(const int& j : i.second)
+                    shared[j] = 1;
+            std::vector<int>().swap(split_);
+            split_.reserve(dof_);
+            for(int i = 0; i < dof_; ++i)
+                if(shared[i])
+                    split_.emplace_back(i);
+            boundary_ = split_.size();
+            for(int i = 0; i < dof_; ++i)
+                if(!shared[i])
+                    split_.emplace_back(i);
+        }
+#if HPDDM_NEIGHBOR_COLLECTIVE
+        /* Variable: graph
+         *  Distributed graph communicator matching <Subdomain::map>, used for neighborhood collective operations. */
+        MPI_Comm                 graph_;
+        /* Variable: counts
+         *  Counts and displacements of the messages exchanged with neighboring subdomains using <Subdomain::graph>. */
+        int*                    counts_;
+        /* Function: neighborExchange
+         *
+         *  Sends and receives blocks of k vectors to and from all neighboring subdomains using <Subdomain::graph>.
+         *
+         * Parameters:
+         *    buff           - Receiving buffers followed by sending buffers, laid out as in <Subdomain::setBuffer>.
+         *    k              - Number of vectors. */
+        template<class T>
+        void neighborExchange(T* const* const buff, const unsigned short& k = 1) const {
+            const unsigned short size = map_.size();
+            for(unsigned short i = 0; i < size; ++i) {
+                counts_[i] = k * map_[i].second.size();
+                counts_[size + i] = std::distance(buff[0], buff[i]);
+            }
+            MPI_Neighbor_alltoallv(size ? buff[size] : nullptr, counts_, counts_ + size, Wrapper<T>::mpi_type(), size ? buff[0] : nullptr, counts_, counts_ + size, Wrapper<T>::mpi_type(), graph_);
+        }
+        /* Function: buildGraph
+         *  Builds <Subdomain::graph> once <Subdomain::map> is known, after freeing the one of a previous initialization. */
+        void buildGraph() {
+            if(graph_ != MPI_COMM_NULL)
+                MPI_Comm_free(&graph_);
+            delete [] counts_;
+            std::vector<int> ranks;
+            ranks.reserve(map_.size());
+            for(const pairNeighbor& i : map_)
+                ranks.emplace_back(i.first);
+            MPI_Dist_graph_create_adjacent(communicator_, ranks.size(), ranks.data(), MPI_UNWEIGHTED, ranks.size(), ranks.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, 0, &graph_);
+            counts_ = new int[2 * map_.size()];
+        }
+#endif
         void dtor() {
             clearBuffer();
+#if HPDDM_NEIGHBOR_COLLECTIVE
+            if(graph_ != MPI_COMM_NULL)
+                MPI_Comm_free(&graph_);
+            delete [] counts_;
+            counts_ = nullptr;
+#endif
+            std::vector<int>().swap(split_);
+            boundary_ = 0;
             delete [] rq_;
             rq_ = nullptr;
             vectorNeighbor().swap(map_);
@@ -76,12 +147,20 @@ class Subdomain
 #if !HPDDM_PETSC
                       OptionsPrefix<K>(),
 #endif
-                                          a_(), buff_(), map_(), rq_(), dof_() { }
+                                          a_(), buff_(), map_(), rq_(), dof_(), mu_(), split_(), boundary_()
+#if HPDDM_NEIGHBOR_COLLECTIVE
+                                                                                         , graph_(MPI_COMM_NULL), counts_()
+#endif
+                                                                                                                           { }
         Subdomain(const Subdomain<K>& s) :
 #if !HPDDM_PETSC
                                            OptionsPrefix<K>(),
 #endif
-                                                               a_(), buff_(new K*[2 * s.map_.size()]), map_(s.map_), rq_(new MPI_Request[2 * s.map_.size()]), communicator_(s.communicator_), dof_(s.dof_) { }
+                                                               a_(), buff_(new K*[2 * s.map_.size()]), map_(s.map_), rq_(new MPI_Request[2 * s.map_.size()]), communicator_(s.communicator_), dof_(s.dof_), mu_(), split_(s.split_), boundary_(s.boundary_)
+#if HPDDM_NEIGHBOR_COLLECTIVE
+                                                                                                                                                                                                                                     , graph_(MPI_COMM_NULL), counts_()
+#endif
+                                                                                                                                                                                                                                                                       { }
         ~Subdomain() {
             dtor();
         }
@@ -92,27 +171,83 @@ class Subdomain
         /* Function: getMap
          *  Returns a reference to <Subdomain::map>. */
         const vectorNeighbor& getMap() const { return map_; }
+        /* Function: volume
+         *  Returns the number of bytes sent to all neighbors when exchanging values of duplicated unknowns of a given number of vectors, see <Profiler>. */
+        std::size_t volume(const unsigned short& mu) const {
+            return mu * sizeof(K) * std::accumulate(map_.cbegin(), map_.cend(), std::size_t(), [](std::size_t sum, const pairNeighbor& n) { return sum + n.second.size(); });
+        }
         /* Function: exchange
          *
-         *  Exchanges and reduces values of duplicated unknowns.
+         *  Exchanges and reduces values of duplicated unknowns. Up to <Subdomain::mu> vectors are packed in a single message per neighbor.
          *
-         * Parameter:
-         *    in             - Input vector. */
+         * Parameters:
+         *    in             - Input vectors.
+         *    mu             - Number of vectors. */
         void exchange(K* const in, const unsigned short& mu = 1) const {
-            for(unsigned short nu = 0; nu < mu; ++nu) {
-                for(unsigned short i = 0, size = map_.size(); i < size; ++i) {
-                    MPI_Irecv(buff_[i], map_[i].second.size(), Wrapper<K>::mpi_type(), map_[i].first, 0, communicator_, rq_ + i);
-                    Wrapper<K>::gthr(map_[i].second.size(), in + nu * dof_, buff_[size + i], map_[i].second.data());
-                    MPI_Isend(buff_[size + i], map_[i].second.size(), Wrapper<K>::mpi_type(), map_[i].first, 0, communicator_, rq_ + size + i);
+            const unsigned short batch = std::max(static_cast<unsigned short>(1), mu_);
+            for(unsigned short nu = 0; nu < mu; nu += batch) {
+                const unsigned short k = std::min(static_cast<unsigned short>(mu - nu), batch);
+#if HPDDM_NEIGHBOR_COLLECTIVE
+                if(graph_ != MPI_COMM_NULL) {
+                    Profiler::Event event(Profiler::EXCHANGE, [&] { return volume(k); });
+                    for(unsigned short i = 0, size = map_.size(); i < size; ++i)
+                        for(unsigned short j = 0; j < k; ++j)
+                            Wrapper<K>::gthr(map_[i].second.size(), in + (nu + j) * dof_, buff_[size + i] + j * map_[i].second.size(), map_[i].second.data());
+                    neighborExchange(buff_, k);
+                    for(unsigned short i = 0; i < map_.size(); ++i) {
+                        const unsigned int n = map_[i].second.size();
+                        for(unsigned short j = 0; j < k; ++j) {
+                            K* const x = in + (nu + j) * dof_;
+                            const K* const recv = buff_[i] + j * n;
+                            for(unsigned int l = 0; l < n; ++l)
+                                x[map_[i].second[l]] += recv[l];
+                        }
+                    }
+                    continue;
                 }
-                for(unsigned short i = 0; i < map_.size(); ++i) {
-                    int index;
-                    ignore(MPI_Waitany(map_.size(), rq_, &index, MPI_STATUS_IGNORE));
-                    for(unsigned int j = 0; j < map_[index].second.size(); ++j)
-                        in[map_[index].second[j] + nu * dof_] += buff_[index][j];
+#endif
+                exchangeBegin(in + nu * dof_, k);
+                exchangeEnd(in + nu * dof_, k);
+            }
+        }
+        /* Function: exchangeBegin
+         *
+         *  Starts the exchange of values of duplicated unknowns. Only the values of the unknowns shared with neighboring subdomains must be up to date, see <Subdomain::split>, the others may still be computed before calling <Subdomain::exchangeEnd>.
+         *
+         * Parameters:
+         *    in             - Input vectors.
+         *    mu             - Number of vectors, at most <Subdomain::mu>. */
+        void exchangeBegin(const K* const in, const unsigned short& mu = 1) const {
+            Profiler::Event event(Profiler::EXCHANGE, [&] { return volume(mu); });
+            for(unsigned short i = 0, size = map_.size(); i < size; ++i) {
+                const int n = map_[i].second.size();
+                MPI_Irecv(buff_[i], mu * n, Wrapper<K>::mpi_type(), map_[i].first, 0, communicator_, rq_ + i);
+                for(unsigned short nu = 0; nu < mu; ++nu)
+                    Wrapper<K>::gthr(n, in + nu * dof_, buff_[size + i] + nu * n, map_[i].second.data());
+                MPI_Isend(buff_[size + i], mu * n, Wrapper<K>::mpi_type(), map_[i].first, 0, communicator_, rq_ + size + i);
+            }
+        }
+        /* Function: exchangeEnd
+         *
+         *  Completes the exchange started by <Subdomain::exchangeBegin> and reduces values of duplicated unknowns. The call is accounted for by <Subdomain::exchangeBegin>, only the time spent waiting is added to the <Profiler>.
+         *
+         * Parameters:
+         *    in             - Input vectors.
+         *    mu             - Number of vectors. */
+        void exchangeEnd(K* const in, const unsigned short& mu = 1) const {
+            Profiler::Event event(Profiler::EXCHANGE, 0, 0);
+            for(unsigned short i = 0; i < map_.size(); ++i) {
+                int index;
+                ignore(MPI_Waitany(map_.size(), rq_, &index, MPI_STATUS_IGNORE));
+                const unsigned int n = map_[index].second.size();
+                for(unsigned short nu = 0; nu < mu; ++nu) {
+                    K* const x = in + nu * dof_;
+                    const K* const recv = buff_[index] + nu * n;
+                    for(unsigned int j = 0; j < n; ++j)
+                        x[map_[index].second[j]] += recv[j];
                 }
-                ignore(MPI_Waitall(map_.size(), rq_ + map_.size(), MPI_STATUSES_IGNORE));
             }
+            ignore(MPI_Waitall(map_.size(), rq_ + map_.size(), MPI_STATUSES_IGNORE));
         }
         template<class T, typename std::enable_if<!HPDDM::Wrapper<K>::is_complex && HPDDM::Wrapper<T>::is_complex && std::is_same<K, underlying_type<T>>::value>::type* = nullptr>
         void exchange(T* const in, const unsigned short& mu = 1) const {
@@ -130,6 +265,14 @@ class Subdomain
          * Parameter:
          *    in             - Input vector. */
         void recvBuffer(const K* const in) const {
+#if HPDDM_NEIGHBOR_COLLECTIVE
+            if(graph_ != MPI_COMM_NULL) {
+                for(unsigned short i = 0, size = map_.size(); i < size; ++i)
+                    Wrapper<K>::gthr(map_[i].second.size(), in, buff_[size + i], map_[i].second.data());
+                neighborExchange(buff_);
+                return;
+            }
+#endif
             for(unsigned short i = 0, size = map_.size(); i < size; ++i) {
                 MPI_Irecv(buff_[i], map_[i].second.size(), Wrapper<K>::mpi_type(), map_[i].first, 0, communicator_, rq_ + i);
                 Wrapper<K>::gthr(map_[i].second.size(), in, buff_[size + i], map_[i].second.data());
@@ -228,6 +371,10 @@ class Subdomain
             delete [] perm;
             rq_ = new MPI_Request[2 * map_.size()];
             buff_ = new K*[2 * map_.size()]();
+            buildSplit();
+#if HPDDM_NEIGHBOR_COLLECTIVE
+            buildGraph();
+#endif
         }
 #ifndef PETSC_PCHPDDM_MAXLEVELS
         void initialize(MatrixCSR<K>* const& a, const int neighbors, const int* const list, const int* const sizes, const int* const* const connectivity, MPI_Comm* const& comm = nullptr) {
@@ -254,25 +401,41 @@ class Subdomain
             }
             rq_ = new MPI_Request[2 * map_.size()];
             buff_ = new K*[2 * map_.size()]();
+            buildSplit();
+#if HPDDM_NEIGHBOR_COLLECTIVE
+            buildGraph();
+#endif
         }
 #endif
-        bool setBuffer(K* wk = nullptr, const int& space = 0) const {
+        /* Function: setBuffer
+         *
+         *  Sets <Subdomain::buff> either using a user-supplied workspace or by allocating new memory, and returns true in the latter case.
+         *
+         * Parameters:
+         *    wk             - Workspace.
+         *    space          - Size of the workspace.
+         *    mu             - Number of vectors exchanged at once. */
+        bool setBuffer(K* wk = nullptr, const int& space = 0, const unsigned short& mu = 1) const {
             int n = std::accumulate(map_.cbegin(), map_.cend(), 0, [](unsigned int init, const pairNeighbor& i) { return init + i.second.size(); });
-            if(n == 0)
+            if(n == 0) {
+                mu_ = mu;
                 return false;
+            }
             bool allocate;
             if(2 * n <= space && wk) {
                 *buff_ = wk;
+                mu_ = std::min(static_cast<int>(mu), space / (2 * n));
                 allocate = false;
             }
             else {
-                *buff_ = new K[2 * n];
+                *buff_ = new K[2 * mu * n];
+                mu_ = mu;
                 allocate = true;
             }
-            buff_[map_.size()] = *buff_ + n;
+            buff_[map_.size()] = *buff_ + mu_ * n;
             n = 0;
             for(unsigned short i = 1, size = map_.size(); i < size; ++i) {
-                n += map_[i - 1].second.size();
+                n += mu_ * map_[i - 1].second.size();
                 buff_[i] = *buff_ + n;
                 buff_[size + i] = buff_[size] + n;
             }
@@ -283,6 +446,7 @@ class Subdomain
                 delete [] *buff_;
                 *buff_ = nullptr;
             }
+            mu_ = 0;
         }
         void end(const bool free = true) const { clearBuffer(free); }
         /* Function: initialize(dummy)
@@ -385,8 +549,14 @@ class Subdomain
                     if(filename.size() != 0) {
                         int sizeWorld;
                         MPI_Comm_size(communicator_, &sizeWorld);
-                        std::ofstream output { filename + "_" + to_string(rankWorld) + "_" + to_string(sizeWorld) + ".txt" };
-                        output << *a_;
+                        if(opt.val<char>(prefix + "dump_binary", 0)) {
+                            std::ofstream output { filename + "_" + to_string(rankWorld) + "_" + to_string(sizeWorld) + ".bin", std::ios::binary };
+                            a_->save(output);
+                        }
+                        else {
+                            std::ofstream output { filename + "_" + to_string(rankWorld) + "_" + to_string(sizeWorld) + ".txt" };
+                            output << *a_;
+                        }
                     }
 #endif
                 }
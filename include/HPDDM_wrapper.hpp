@@ -152,6 +152,36 @@ struct Wrapper {
     template<char N = HPDDM_NUMBERING>
     static void bsrmm(const char* const, const int* const, const int* const, const int* const, const int* const, const K* const, bool,
                       const K* const, const int* const, const int* const, const K* const, const K* const, K* const);
+#if !HPDDM_MKL
+    /* Function: csrmm_block
+     *  Computes a scalar-sparse matrix-matrix product with a compile-time number of right-hand sides interleaved in a work array. */
+    template<char N, int B>
+    static void csrmm_block(const char* const, const int* const, const int* const, const K* const, bool,
+                            const K* const, const int* const, const int* const, const K* const, const int, const K* const, K* const, const int, K* const, const int);
+    /* Class: Scratch
+     *  Work array of at least the requested size, private to the calling thread and reused across sparse products, unless it is larger than HPDDM_SCRATCH_SIZE bytes, in which case it is released when going out of scope. */
+    class Scratch {
+        private:
+            std::vector<K>& work_;
+            static std::vector<K>& storage() {
+                static thread_local std::vector<K> work;
+                return work;
+            }
+        public:
+            explicit Scratch(const std::size_t size) : work_(storage()) {
+                if(work_.size() < size) {
+                    work_.clear();
+                    work_.resize(size);
+                }
+            }
+            Scratch(const Scratch&) = delete;
+            ~Scratch() {
+                if(work_.size() * sizeof(K) > HPDDM_SCRATCH_SIZE)
+                    std::vector<K>().swap(work_);
+            }
+            K* data() const { return work_.data(); }
+    };
+#endif
 
     /* Function: csrcsc
      *  Converts a matrix stored in Compressed Sparse Row format into Compressed Sparse Column format. */
@@ -631,23 +661,64 @@ inline void Wrapper<K>::csrmv(const char* const trans, const int* const m, const
             std::fill_n(y, *k, K());
         else if(beta != &d__1)
             Blas<K>::scal(k, beta, y, &i__1);
-        if(sym) {
-            for(int i = 0; i < *m; ++i)
-                for(int l = ia[i] - (N == 'F'); l < ia[i + 1] - (N == 'F'); ++l) {
-                    int j = ja[l] - (N == 'F');
-                    const K scal = *alpha * (Wrapper<K>::is_complex && *trans == 'C' ? conj(a[l]) : a[l]);
-                    y[i] += scal * x[j];
-                    if(i != j)
-                        y[j] += scal * x[i];
-                }
+        int threads = 1;
+#ifdef _OPENMP
+        threads = std::max(1, std::min(omp_get_max_threads(), (ia[*m] - (N == 'F')) / HPDDM_GRANULARITY));
+#endif
+        if(threads == 1) {
+            if(sym) {
+                for(int i = 0; i < *m; ++i)
+                    for(int l = ia[i] - (N == 'F'); l < ia[i + 1] - (N == 'F'); ++l) {
+                        int j = ja[l] - (N == 'F');
+                        const K scal = *alpha * (Wrapper<K>::is_complex && *trans == 'C' ? conj(a[l]) : a[l]);
+                        y[i] += scal * x[j];
+                        if(i != j)
+                            y[j] += scal * x[i];
+                    }
+            }
+            else {
+                for(int i = 0; i < *m; ++i)
+                    for(int j = ia[i] - (N == 'F'); j < ia[i + 1] - (N == 'F'); ++j) {
+                        const K scal = *alpha * (Wrapper<K>::is_complex && *trans == 'C' ? conj(a[j]) : a[j]);
+                        y[ja[j] - (N == 'F')] += scal * x[i];
+                    }
+            }
         }
+#ifdef _OPENMP
         else {
-            for(int i = 0; i < *m; ++i)
-                for(int j = ia[i] - (N == 'F'); j < ia[i + 1] - (N == 'F'); ++j) {
-                    const K scal = *alpha * (Wrapper<K>::is_complex && *trans == 'C' ? conj(a[j]) : a[j]);
-                    y[ja[j] - (N == 'F')] += scal * x[i];
+            const Scratch scratch(static_cast<std::size_t>(threads - 1) * *k);
+            K* const z = scratch.data();
+            const bool conjugate = (Wrapper<K>::is_complex && *trans == 'C');
+            int team = 1;
+#pragma omp parallel num_threads(threads)
+            {
+#pragma omp single
+                team = omp_get_num_threads();
+                const int t = omp_get_thread_num();
+                K* const zt = (t ? z + (t - 1) * *k : y);
+                if(t)
+                    std::fill_n(zt, *k, K());
+#pragma omp for schedule(static)
+                for(int i = 0; i < *m; ++i) {
+                    K acc = K();
+                    for(int l = ia[i] - (N == 'F'); l < ia[i + 1] - (N == 'F'); ++l) {
+                        const int j = ja[l] - (N == 'F');
+                        const K scal = *alpha * (conjugate ? conj(a[l]) : a[l]);
+                        if(sym)
+                            acc += scal * x[j];
+                        if(!sym || i != j)
+                            zt[j] += scal * x[i];
+                    }
+                    if(sym)
+                        zt[i] += acc;
                 }
+#pragma omp for schedule(static)
+                for(int i = 0; i < *k; ++i)
+                    for(int l = 0; l < team - 1; ++l)
+                        y[i] += z[l * *k + i];
+            }
         }
+#endif
     }
 }
 template<class K>
@@ -700,47 +771,123 @@ inline void Wrapper<K>::bsrmv(const char* const trans, const int* const m, const
     }
 }
 template<class K>
-template<char N>
-inline void Wrapper<K>::csrmm(const char* const trans, const int* const m, const int* const n, const int* const k, const K* const alpha, bool sym,
-                              const K* const a, const int* const ia, const int* const ja, const K* const x,  const K* const beta, K* const y) {
-    if(*trans == 'N' || sym) {
-        int j = *m * *n;
-        if(beta == &d__0)
-            std::fill_n(y, j, K());
-        else if(beta != &d__1)
-            Blas<K>::scal(&j, beta, y, &i__1);
-        if(sym) {
-            for(int i = 0; i < *m; ++i)
+template<char N, int B>
+inline void Wrapper<K>::csrmm_block(const char* const trans, const int* const m, const int* const k, const K* const alpha, bool sym,
+                                    const K* const a, const int* const ia, const int* const ja, const K* const x, const int ldx, const K* const beta, K* const y, const int ldy, K* const work, const int threads) {
+    const bool gather = (*trans == 'N' && !sym);
+    for(int i = 0; i < ldx; ++i)
+        for(int c = 0; c < B; ++c)
+            work[i * B + c] = x[i + c * ldx];
+    if(gather) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, HPDDM_GRANULARITY)
+#endif
+        for(int i = 0; i < *m; ++i) {
+            K acc[B] = { };
+            for(int j = ia[i] - (N == 'F'); j < ia[i + 1] - (N == 'F'); ++j) {
+                const K* const xj = work + B * (ja[j] - (N == 'F'));
+                for(int c = 0; c < B; ++c)
+                    acc[c] += a[j] * xj[c];
+            }
+            for(int c = 0; c < B; ++c)
+                y[i + c * ldy] = (beta == &d__0 ? K() : *beta * y[i + c * ldy]) + *alpha * acc[c];
+        }
+    }
+    else {
+        K* const z = work + ldx * B;
+        const bool conjugate = (Wrapper<K>::is_complex && *trans == 'C');
+        int team = 1;
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads)
+#endif
+        {
+#ifdef _OPENMP
+#pragma omp single
+            team = omp_get_num_threads();
+            K* const zt = z + omp_get_thread_num() * ldy * B;
+#else
+            K* const zt = z;
+#endif
+            std::fill_n(zt, ldy * B, K());
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for(int i = 0; i < *m; ++i) {
+                K xi[B], acc[B] = { };
+                std::copy_n(work + i * B, B, xi);
                 for(int l = ia[i] - (N == 'F'); l < ia[i + 1] - (N == 'F'); ++l) {
-                    j = ja[l] - (N == 'F');
-                    const K scal = *alpha * (Wrapper<K>::is_complex && *trans == 'C' ? conj(a[l]) : a[l]);
-                    Blas<K>::axpy(n, &scal, x + j, k, y + i, m);
-                    if(i != j)
-                        Blas<K>::axpy(n, &scal, x + i, k, y + j, m);
+                    const int j = ja[l] - (N == 'F');
+                    const K scal = conjugate ? conj(a[l]) : a[l];
+                    if(sym) {
+                        const K* const xj = work + j * B;
+                        for(int c = 0; c < B; ++c)
+                            acc[c] += scal * xj[c];
+                    }
+                    if(!sym || i != j) {
+                        K* const yj = zt + j * B;
+                        for(int c = 0; c < B; ++c)
+                            yj[c] += scal * xi[c];
+                    }
                 }
-        }
-        else {
+                if(sym)
+                    for(int c = 0; c < B; ++c)
+                        zt[i * B + c] += acc[c];
+            }
 #ifdef _OPENMP
-#pragma omp for schedule(static, HPDDM_GRANULARITY)
+#pragma omp for schedule(static)
 #endif
-            for(int i = 0; i < *m; ++i)
-                for(j = ia[i] - (N == 'F'); j < ia[i + 1] - (N == 'F'); ++j) {
-                    const K scal = *alpha * a[j];
-                    Blas<K>::axpy(n, &scal, x + ja[j] - (N == 'F'), k, y + i, m);
+            for(int i = 0; i < ldy; ++i)
+                for(int c = 0; c < B; ++c) {
+                    K sum = z[i * B + c];
+                    for(int t = 1; t < team; ++t)
+                        sum += z[(t * ldy + i) * B + c];
+                    y[i + c * ldy] = (beta == &d__0 ? K() : *beta * y[i + c * ldy]) + *alpha * sum;
                 }
         }
     }
-    else {
-        int j = *k * *n;
-        if(beta == &d__0)
-            std::fill_n(y, j, K());
-        else if(beta != &d__1)
-            Blas<K>::scal(&j, beta, y, &i__1);
-        for(int i = 0; i < *m; ++i)
-            for(int j = ia[i] - (N == 'F'); j < ia[i + 1] - (N == 'F'); ++j) {
-                const K scal = *alpha * (Wrapper<K>::is_complex && *trans == 'C' ? conj(a[j]) : a[j]);
-                Blas<K>::axpy(n, &scal, x + i, m, y + ja[j] - (N == 'F'), k);
+}
+template<class K>
+template<char N>
+inline void Wrapper<K>::csrmm(const char* const trans, const int* const m, const int* const n, const int* const k, const K* const alpha, bool sym,
+                              const K* const a, const int* const ia, const int* const ja, const K* const x,  const K* const beta, K* const y) {
+    if(*n == 1)
+        csrmv<N>(trans, m, k, alpha, sym, a, ia, ja, x, beta, y);
+    else if(*n > 1) {
+        const bool gather = (*trans == 'N' && !sym);
+        const int ldx = (gather || sym ? *k : *m);
+        const int ldy = (gather || sym ? *m : *k);
+        int threads = 1;
+#ifdef _OPENMP
+        if(!gather)
+            threads = std::max(1, std::min(omp_get_max_threads(), (ia[*m] - (N == 'F')) / HPDDM_GRANULARITY));
+#endif
+        const int b = (*n >= 16 ? 16 : *n >= 8 ? 8 : *n >= 4 ? 4 : 2);
+        const Scratch scratch(b * (ldx + (gather ? 0 : static_cast<std::size_t>(threads) * ldy)));
+        K* const work = scratch.data();
+        for(int c = 0; c < *n; ) {
+            const K* const xc = x + c * ldx;
+            K* const yc = y + c * ldy;
+            if(*n - c >= 16) {
+                csrmm_block<N, 16>(trans, m, k, alpha, sym, a, ia, ja, xc, ldx, beta, yc, ldy, work, threads);
+                c += 16;
+            }
+            else if(*n - c >= 8) {
+                csrmm_block<N, 8>(trans, m, k, alpha, sym, a, ia, ja, xc, ldx, beta, yc, ldy, work, threads);
+                c += 8;
+            }
+            else if(*n - c >= 4) {
+                csrmm_block<N, 4>(trans, m, k, alpha, sym, a, ia, ja, xc, ldx, beta, yc, ldy, work, threads);
+                c += 4;
             }
+            else if(*n - c >= 2) {
+                csrmm_block<N, 2>(trans, m, k, alpha, sym, a, ia, ja, xc, ldx, beta, yc, ldy, work, threads);
+                c += 2;
+            }
+            else {
+                csrmm_block<N, 1>(trans, m, k, alpha, sym, a, ia, ja, xc, ldx, beta, yc, ldy, work, threads);
+                ++c;
+            }
+        }
     }
 }
 template<class K>